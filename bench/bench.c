@@ -0,0 +1,748 @@
+// Benchmarks for the game logic (no display needed)
+//
+// Usage: bench [all|logic|render] [max tiles] [--display]
+//        bench files level.txt...  (levels from disk, txt or compiled)
+//
+// The render cases draw to memory bitmaps, or to a display with --display
+// (also tried when LIBGL_ALWAYS_SOFTWARE is set, for Mesa's llvmpipe)
+//
+// Results are written to stdout as JSON, one entry per case with the
+// min/median/p99 time in microseconds
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <allegro5/allegro.h>
+#include <allegro5/allegro_image.h>
+#include <allegro5/allegro_memfile.h>
+#include "../src/game.h"
+#include "../src/aabb.h"
+#include "../src/tilemap.h"
+#include "../src/collision.h"
+#include "../src/player.h"
+#include "../src/states/gamestate.h"
+#include "../src/data/level.h"
+#include "../src/data/main_gfx.h"
+#include "../src/data/sprites.h"
+#include "bench.h"
+
+// Synthetic level: a long strip of 32x32 tiles, 16 rows tall
+#define AABB_BOXES      (1 << 20)
+#define AABB_QUERIES    256
+
+// Level sizes (in tiles) tried after the shipped level, up to 'max tiles'
+static int level_sizes[] = { 16384, 262144, 1048576, 4194304 };
+
+#define LEVEL_SIZES     (sizeof(level_sizes) / sizeof(int))
+#define DEFAULT_MAX     4194304
+
+// Tiles in every column of the synthetic levels
+#define SYNTH_PER_COL   3
+
+// Ticks simulated by the camera and collision cases
+#define SWEEP_TICKS     3000
+#define PLAYER_STARTS   32
+#define PLAYER_TICKS    100
+
+static int first_case = 1;
+
+static int compare_double(const void* a, const void* b)
+{
+    double d = *(const double*) a - *(const double*) b;
+    return (d > 0) - (d < 0);
+}
+
+int want_run(int run, double spent)
+{
+    return run < MIN_RUNS || (run < MAX_RUNS && spent < RUN_BUDGET);
+}
+
+void report(const char* name, const char* params, double* times,
+  int count)
+{
+    int p99 = (count * 99 + 99) / 100 - 1;
+
+    qsort(times, count, sizeof(double), compare_double);
+
+    printf("%s\n    { \"case\": \"%s\", %s%s\"runs\": %d, \"min_us\": %.3f, "
+        "\"median_us\": %.3f, \"p99_us\": %.3f }", first_case ? "" : ",",
+        name, params != NULL ? params : "", params != NULL ? ", " : "",
+        count, times[0] * 1e6, times[count / 2] * 1e6, times[p99] * 1e6);
+
+    fflush(stdout);
+    first_case = 0;
+}
+
+void report_unsupported(const char* name, const char* params)
+{
+    printf("%s\n    { \"case\": \"%s\", %s%s\"supported\": false }",
+        first_case ? "" : ",", name, params != NULL ? params : "",
+        params != NULL ? ", " : "");
+
+    fflush(stdout);
+    first_case = 0;
+}
+
+// The old way, one box at a time with the macro
+static int test_macro(struct AABB_Store* s, float x, float y, float w, float h)
+{
+    int i, hits = 0;
+
+    for (i=0; i<s->count; ++i)
+    {
+        if (check_bb_collision(x, y, w, h, s->x1[i], s->y1[i],
+            s->x2[i] - s->x1[i], s->y2[i] - s->y1[i]))
+        {
+            ++hits;
+        }
+    }
+
+    return hits;
+}
+
+static void bench_aabb()
+{
+    int i, j, run, impl;
+    struct AABB_Store store;
+    float qx[AABB_QUERIES], qy[AABB_QUERIES];
+    int expected[AABB_QUERIES];
+    unsigned int* mask = malloc(sizeof(unsigned int) * (AABB_BOXES / 32 + 1));
+    double times[MAX_RUNS], spent = 0;
+    char params[64];
+
+    aabb_init(&store);
+
+    for (i=0; i<AABB_BOXES; ++i)
+    {
+        aabb_add(&store, (i / 16) * 32, (i % 16) * 32, 32, 32);
+    }
+
+    for (i=0; i<AABB_QUERIES; ++i)
+    {
+        qx[i] = rand() % ((AABB_BOXES / 16) * 32);
+        qy[i] = rand() % (16 * 32);
+    }
+
+    snprintf(params, sizeof(params), "\"impl\": \"macro\", \"boxes\": %d",
+        AABB_BOXES);
+
+    // Macro first (it's also what the others are checked against)
+    for (run=0; want_run(run, spent); ++run)
+    {
+        double t = al_get_time();
+
+        for (j=0; j<AABB_QUERIES; ++j)
+        {
+            expected[j] = test_macro(&store, qx[j], qy[j], 22, 23);
+        }
+
+        t = al_get_time() - t;
+        spent += t;
+        times[run] = t / AABB_QUERIES;
+    }
+
+    report("aabb_query", params, times, run);
+
+    for (impl=0; impl<AABB_IMPL_COUNT; ++impl)
+    {
+        if (!aabb_select(impl))
+        {
+            fprintf(stderr, "WARNING: aabb %s not supported\n",
+                aabb_impl_name(impl));
+            continue;
+        }
+
+        snprintf(params, sizeof(params), "\"impl\": \"%s\", \"boxes\": %d",
+            aabb_impl_name(impl), AABB_BOXES);
+        spent = 0;
+
+        for (run=0; want_run(run, spent); ++run)
+        {
+            double t = al_get_time();
+
+            for (j=0; j<AABB_QUERIES; ++j)
+            {
+                if (aabb_test(&store, qx[j], qy[j], 22, 23, mask)
+                    != expected[j])
+                {
+                    fprintf(stderr, "ERROR: %s disagrees with the macro\n",
+                        aabb_impl_name(impl));
+                    exit(1);
+                }
+            }
+
+            t = al_get_time() - t;
+            spent += t;
+            times[run] = t / AABB_QUERIES;
+        }
+
+        report("aabb_query", params, times, run);
+    }
+
+    aabb_free(&store);
+    free(mask);
+}
+
+static void add_tile(struct Level_Text* t, struct Tile* type, int col,
+  int row)
+{
+    if (t->length + 64 > t->size)
+    {
+        t->size = t->size * 2 + 4096;
+        t->data = realloc(t->data, t->size);
+    }
+
+    t->length += sprintf(t->data + t->length, "1 %d %d %d %d %d %d\n",
+        type->left, type->top, TILE_SIZE, TILE_SIZE, col * TILE_SIZE,
+        row * TILE_SIZE);
+    ++t->tiles;
+}
+
+// Boxes that end up exactly touching a tile have to report the contact
+// (the sweep used to miss them); exits like the aabb checks if they don't
+static void check_contacts(struct Tilemap* shipped)
+{
+    int col;
+    float x, y;
+    struct Level_Text t;
+    struct Tilemap* map;
+    struct Contact contact;
+
+    // Floor along row 10, a wall in the first chunk and one that ends
+    // where the second chunk starts
+    memset(&t, 0, sizeof(t));
+
+    for (col=0; col<CHUNK_COLS * 2; ++col)
+    {
+        add_tile(&t, &shipped->types[0], col, 10);
+    }
+
+    add_tile(&t, &shipped->types[0], 8, 9);
+    add_tile(&t, &shipped->types[0], CHUNK_COLS - 1, 9);
+
+    map = level_from_txt(&t);
+    free(t.data);
+    colliders = create_colliders(map);
+
+    // Landing: 5 pixels above the floor, moving down 5
+    x = 2 * TILE_SIZE;
+    y = 10 * TILE_SIZE - 32 - 5;
+    move_box(colliders, &x, &y, 24, 32, 0, 5, &contact);
+
+    if (!contact.grounded || y != 10 * TILE_SIZE - 32)
+    {
+        fprintf(stderr, "ERROR: Flush landing not grounded\n");
+        exit(1);
+    }
+
+    // Walls: 5 pixels away, moving 5 towards them
+    x = 8 * TILE_SIZE - 24 - 5;
+    move_box(colliders, &x, &y, 24, 32, 5, 0, &contact);
+
+    if (!contact.wall_right || x != 8 * TILE_SIZE - 24)
+    {
+        fprintf(stderr, "ERROR: Flush wall (right) not hit\n");
+        exit(1);
+    }
+
+    x = CHUNK_COLS * TILE_SIZE + 5;
+    move_box(colliders, &x, &y, 24, 32, -5, 0, &contact);
+
+    if (!contact.wall_left || x != CHUNK_COLS * TILE_SIZE)
+    {
+        fprintf(stderr, "ERROR: Flush wall (left) not hit\n");
+        exit(1);
+    }
+
+    destroy_colliders(colliders);
+    colliders = NULL;
+    destroy_tilemap(map);
+}
+
+void shipped_level_txt(struct Tilemap* map, struct Level_Text* t)
+{
+    int col, row;
+
+    for (col=0; col<map->cols; ++col)
+    {
+        for (row=0; row<map->rows; ++row)
+        {
+            int cell = tilemap_get(map, col, row);
+
+            if (cell != 0)
+            {
+                add_tile(t, &map->types[cell - 1], col, row);
+            }
+        }
+    }
+}
+
+void synthetic_level_txt(struct Tilemap* shipped, int tiles, int per_col,
+  struct Level_Text* t)
+{
+    int col, i;
+    int cols = tiles / per_col;
+    int rows[SYNTH_ROWS - 1];
+
+    for (i=0; i<SYNTH_ROWS - 1; ++i)
+    {
+        rows[i] = i;
+    }
+
+    for (col=0; col<cols; ++col)
+    {
+        add_tile(t, &shipped->types[0], col, SYNTH_ROWS - 1);
+
+        // Different rows each (a partial shuffle), so the count is exact
+        for (i=0; i<per_col - 1; ++i)
+        {
+            int j = i + rand() % (SYNTH_ROWS - 1 - i);
+            int row = rows[j];
+
+            rows[j] = rows[i];
+            rows[i] = row;
+
+            add_tile(t, &shipped->types[rand() % shipped->type_count], col,
+                row);
+        }
+    }
+}
+
+struct Tilemap* level_from_txt(struct Level_Text* t)
+{
+    ALLEGRO_FILE* f = al_open_memfile(t->data, t->length, "r");
+    struct Tilemap* map = load_tilemap_txt(f);
+
+    al_fclose(f);
+
+    if (map == NULL)
+    {
+        fprintf(stderr, "ERROR: Could not load a level from text\n");
+        exit(1);
+    }
+
+    return map;
+}
+
+// Compiles a level loaded from text to the format load_tilemap() reads
+// (like tools/levelc does)
+static ALLEGRO_FILE* compile_level(struct Tilemap* map, unsigned char** data,
+  int64_t* length)
+{
+    int i;
+    unsigned char block[4096];
+    size_t n;
+    int64_t left = (int64_t) map->cols * map->rows;
+    ALLEGRO_FILE* f;
+
+    *length = 20 + map->type_count * 4 + (int64_t) map->cols * map->rows;
+    *data = malloc(*length);
+    f = al_open_memfile(*data, *length, "w");
+
+    al_fwrite(f, "LVL1", 4);
+    al_fwrite32le(f, map->cols);
+    al_fwrite32le(f, map->rows);
+    al_fwrite32le(f, map->tile_count);
+    al_fwrite32le(f, map->type_count);
+
+    for (i=0; i<map->type_count; ++i)
+    {
+        al_fwrite16le(f, map->types[i].left);
+        al_fwrite16le(f, map->types[i].top);
+    }
+
+    // Cells are copied from the file the level streams from
+    al_fseek(map->file, map->offset, ALLEGRO_SEEK_SET);
+
+    while (left > 0 && (n = al_fread(map->file, block,
+        left < (int64_t) sizeof(block) ? left : sizeof(block))) > 0)
+    {
+        al_fwrite(f, block, n);
+        left -= n;
+    }
+
+    al_fclose(f);
+
+    return al_open_memfile(*data, *length, "r");
+}
+
+// Parsing level.txt; returns the last level loaded
+static struct Tilemap* bench_level_txt(struct Level_Text* t, char* params)
+{
+    int run;
+    double times[MAX_RUNS], spent = 0;
+    struct Tilemap* map = NULL;
+
+    for (run=0; want_run(run, spent); ++run)
+    {
+        double start = al_get_time();
+
+        if (map != NULL)
+        {
+            destroy_tilemap(map);
+        }
+
+        map = level_from_txt(t);
+
+        times[run] = al_get_time() - start;
+        spent += times[run];
+    }
+
+    report("level_load_txt", params, times, run);
+
+    return map;
+}
+
+// Loading a compiled level, and then reading every chunk of it once; from
+// memory, or from disk if there's a file name
+static void bench_level_lvl(unsigned char* data, int64_t length,
+  const char* filename, char* params)
+{
+    int run, x, loads = 0, misses = 0;
+    double times[MAX_RUNS], spent = 0;
+    char counted[512];
+
+    for (run=0; want_run(run, spent); ++run)
+    {
+        double start = al_get_time();
+        struct Tilemap* map = (filename != NULL ? load_tilemap_file(filename)
+            : load_tilemap(al_open_memfile(data, length, "r")));
+
+        for (x=0; x<map->cols * TILE_SIZE; x+=CHUNK_COLS * TILE_SIZE)
+        {
+            tilemap_stream(map, x, CHUNK_COLS * TILE_SIZE, 0);
+        }
+
+        loads = map->chunk_loads;
+        misses = map->chunk_misses;
+        destroy_tilemap(map);
+
+        times[run] = al_get_time() - start;
+        spent += times[run];
+    }
+
+    // Chunks read by the last run
+    snprintf(counted, sizeof(counted), "%s, \"chunk_loads\": %d, "
+        "\"chunk_misses\": %d", params, loads, misses);
+    report("level_load_lvl", counted, times, run);
+}
+
+// What a tick does to know what's on screen: stream in the chunks around the
+// camera and go through the visible cells (times are per tick)
+static void bench_visible(struct Tilemap* map, char* params)
+{
+    int run, tick, c, r, col1, row1, col2, row2;
+    double times[MAX_RUNS], spent = 0;
+    float start_x = map->cols * TILE_SIZE / 2;
+    volatile int visible = 0;
+    char counted[512];
+
+    for (run=0; want_run(run, spent); ++run)
+    {
+        double start = al_get_time();
+        float x = start_x;
+
+        map->chunk_loads = 0;
+        map->chunk_misses = 0;
+
+        for (tick=0; tick<SWEEP_TICKS; ++tick)
+        {
+            tilemap_stream(map, x, 640, 6);
+
+            if (tilemap_get_range(map, x, 0, 640, 480, &col1, &row1, &col2,
+                &row2))
+            {
+                for (c=col1; c<=col2; ++c)
+                {
+                    for (r=row1; r<=row2; ++r)
+                    {
+                        if (tilemap_get(map, c, r))
+                        {
+                            ++visible;
+                        }
+                    }
+                }
+            }
+
+            x += 6;
+
+            if (x >= (map->cols - 20) * TILE_SIZE)
+            {
+                x = 0;
+            }
+        }
+
+        times[run] = (al_get_time() - start) / SWEEP_TICKS;
+        spent += times[run] * SWEEP_TICKS;
+    }
+
+    // Chunks read while sweeping in the last run; misses are cells asked
+    // for before tilemap_stream() had read their chunk
+    snprintf(counted, sizeof(counted), "%s, \"chunk_loads\": %d, "
+        "\"chunk_misses\": %d", params, map->chunk_loads,
+        map->chunk_misses);
+    report("visible_set", counted, times, run);
+}
+
+// player_update() (movement and collisions) with Luna running and jumping,
+// dropped at several places along the level (times are per update)
+static void bench_player(struct Tilemap* map, char* params)
+{
+    int run, i, tick, x, y;
+    double times[MAX_RUNS], spent = 0;
+    struct Keys keys = { 0, 1, 1, 1, 0, 1 };
+
+    colliders = create_colliders(map);
+
+    for (run=0; want_run(run, spent); ++run)
+    {
+        double start = al_get_time();
+
+        for (i=0; i<PLAYER_STARTS; ++i)
+        {
+            float px = (map->cols - 40) * TILE_SIZE / PLAYER_STARTS * i;
+            struct Player* player = create_player(px, 0, &keys);
+
+            for (tick=0; tick<PLAYER_TICKS; ++tick)
+            {
+                player_get_pos(player, &x, &y);
+                tilemap_stream(map, x - 320, 640, 6);
+                player_update(player);
+            }
+
+            destroy_player(player);
+        }
+
+        times[run] = (al_get_time() - start) / (PLAYER_STARTS * PLAYER_TICKS);
+        spent += times[run] * PLAYER_STARTS * PLAYER_TICKS;
+    }
+
+    report("player_update", params, times, run);
+
+    destroy_colliders(colliders);
+    colliders = NULL;
+}
+
+static void bench_level(struct Level_Text* t, const char* name)
+{
+    char params[256];
+    struct Tilemap* map;
+    unsigned char* data;
+    int64_t length;
+
+    snprintf(params, sizeof(params), "\"level\": \"%s\", \"tiles\": %d",
+        name, t->tiles);
+
+    map = bench_level_txt(t, params);
+
+    // The text is only needed to measure parsing
+    free(t->data);
+    t->data = NULL;
+
+    al_fclose(compile_level(map, &data, &length));
+    bench_level_lvl(data, length, NULL, params);
+    free(data);
+
+    bench_visible(map, params);
+    bench_player(map, params);
+
+    destroy_tilemap(map);
+}
+
+// A level from disk, like the ones from tools/levelgen
+static void bench_level_file(const char* filename)
+{
+    FILE* f = fopen(filename, "rb");
+    struct Level_Text text;
+    char name[128];
+    char params[256];
+    size_t i;
+
+    if (f == NULL)
+    {
+        fprintf(stderr, "ERROR: Could not open %s\n", filename);
+        return;
+    }
+
+    // Goes into JSON as it is
+    for (i=0; filename[i] != '\0' && i < sizeof(name) - 1; ++i)
+    {
+        name[i] = (filename[i] == '"' || filename[i] == '\\') ? '/'
+            : filename[i];
+    }
+
+    name[i] = '\0';
+
+    memset(&text, 0, sizeof(text));
+    fseek(f, 0, SEEK_END);
+    text.size = ftell(f) + 1;
+    text.data = malloc(text.size);
+    fseek(f, 0, SEEK_SET);
+    text.length = fread(text.data, 1, text.size, f);
+    fclose(f);
+
+    if (text.length >= 4 && memcmp(text.data, "LVL1", 4) == 0)
+    {
+        struct Tilemap* map;
+
+        free(text.data);
+        map = load_tilemap_file(filename);
+
+        if (map == NULL)
+        {
+            return;
+        }
+
+        snprintf(params, sizeof(params), "\"level\": \"%s\", \"tiles\": %d",
+            name, map->tile_count);
+
+        bench_level_lvl(NULL, 0, filename, params);
+        bench_visible(map, params);
+        bench_player(map, params);
+
+        destroy_tilemap(map);
+        return;
+    }
+
+    // One tile per line
+    for (i=0; i<text.length; ++i)
+    {
+        if (text.data[i] == '\n')
+        {
+            ++text.tiles;
+        }
+    }
+
+    bench_level(&text, name);
+}
+
+static void bench_decode(const char* name, void* data, unsigned int length)
+{
+    int run;
+    double times[MAX_RUNS], spent = 0;
+    char params[128];
+
+    snprintf(params, sizeof(params), "\"image\": \"%s\", \"bytes\": %u",
+        name, length);
+
+    for (run=0; want_run(run, spent); ++run)
+    {
+        double start = al_get_time();
+        ALLEGRO_BITMAP* bmp = bitmap_from_data(data, length, ".tga");
+
+        times[run] = al_get_time() - start;
+        spent += times[run];
+
+        if (bmp == NULL)
+        {
+            fprintf(stderr, "ERROR: Could not decode %s\n", name);
+            return;
+        }
+
+        al_destroy_bitmap(bmp);
+    }
+
+    report("bitmap_from_data", params, times, run);
+}
+
+int main(int argc, char** argv)
+{
+    int i;
+    int logic = 1, render = 1;
+    int max_tiles = DEFAULT_MAX;
+    int display = (getenv("LIBGL_ALWAYS_SOFTWARE") != NULL);
+    struct Tilemap* shipped;
+    struct Level_Text text;
+
+    // Can go anywhere, the other arguments are by position
+    for (i=1; i<argc; ++i)
+    {
+        if (strcmp(argv[i], "--display") == 0)
+        {
+            display = 1;
+            memmove(&argv[i], &argv[i + 1], sizeof(char*) * (argc - i));
+            --argc;
+            --i;
+        }
+    }
+
+    if (argc > 1 && strcmp(argv[1], "logic") == 0)
+    {
+        render = 0;
+    }
+    else if (argc > 1 && strcmp(argv[1], "render") == 0)
+    {
+        logic = 0;
+    }
+
+    if (argc > 2 && strcmp(argv[1], "files") != 0)
+    {
+        max_tiles = atoi(argv[2]);
+    }
+
+    al_init();
+    al_init_image_addon();
+
+    // No display, so bitmaps can only live in memory
+    al_set_new_bitmap_flags(ALLEGRO_MEMORY_BITMAP);
+
+    srand(1);
+
+    printf("{\n  \"cases\": [");
+
+    shipped = load_tilemap(al_open_memfile(level_lvl_data, level_lvl_length,
+        "r"));
+
+    if (argc > 1 && strcmp(argv[1], "files") == 0)
+    {
+        logic = 0;
+        render = 0;
+
+        for (i=2; i<argc; ++i)
+        {
+            bench_level_file(argv[i]);
+        }
+    }
+
+    if (logic)
+    {
+        bench_aabb();
+        check_contacts(shipped);
+
+        memset(&text, 0, sizeof(text));
+        shipped_level_txt(shipped, &text);
+        bench_level(&text, "shipped");
+
+        for (i=0; i<LEVEL_SIZES && level_sizes[i]<=max_tiles; ++i)
+        {
+            char name[32];
+
+            memset(&text, 0, sizeof(text));
+            synthetic_level_txt(shipped, level_sizes[i], SYNTH_PER_COL,
+                &text);
+
+            sprintf(name, "synthetic-%d", level_sizes[i]);
+            bench_level(&text, name);
+        }
+
+        bench_decode("bg", bg_tga_data, bg_tga_length);
+        bench_decode("cracks", cracks_tga_data, cracks_tga_length);
+        bench_decode("text", text_tga_data, text_tga_length);
+        bench_decode("tiles", tiles_tga_data, tiles_tga_length);
+        bench_decode("tilesred", tilesred_tga_data, tilesred_tga_length);
+        bench_decode("flying", flying_tga_data, flying_tga_length);
+        bench_decode("stand", stand_tga_data, stand_tga_length);
+        bench_decode("trotting", trotting_tga_data, trotting_tga_length);
+    }
+
+    if (render)
+    {
+        bench_render(shipped, display);
+    }
+
+    destroy_tilemap(shipped);
+
+    printf("\n  ]\n}\n");
+
+    return 0;
+}
@@ -0,0 +1,46 @@
+#ifndef BENCH_H_INCLUDED
+#define BENCH_H_INCLUDED
+
+#include <stddef.h>
+
+struct Tilemap;
+
+// Every case runs at least MIN_RUNS times, and then until MAX_RUNS or until
+// it's been going for RUN_BUDGET seconds
+#define MIN_RUNS        3
+#define MAX_RUNS        25
+#define RUN_BUDGET      2.0
+
+int want_run(int run, double spent);
+
+// Writes one case (times are in seconds per operation); 'params' is more
+// JSON fields describing the case, or NULL
+void report(const char* name, const char* params, double* times, int count);
+void report_unsupported(const char* name, const char* params);
+
+// Level in the level.txt format (what load_tilemap_txt() reads)
+struct Level_Text
+{
+    char* data;
+    size_t length, size;
+    int tiles;
+};
+
+// Synthetic levels are as tall as the shipped one
+#define SYNTH_ROWS      15
+
+// The shipped level, back to text
+void shipped_level_txt(struct Tilemap* map, struct Level_Text*);
+
+// Ground all along, with per_col - 1 random tiles above it in every column,
+// using the tiles of the shipped level
+void synthetic_level_txt(struct Tilemap* shipped, int tiles, int per_col,
+    struct Level_Text*);
+
+struct Tilemap* level_from_txt(struct Level_Text*);
+
+// Drawing strategies (render.c), on the bitmaps of a new display if
+// 'display' is set and one can be created
+void bench_render(struct Tilemap* shipped, int display);
+
+#endif // BENCH_H_INCLUDED
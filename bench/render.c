@@ -0,0 +1,448 @@
+// Drawing strategies for the level, timed on a memory bitmap (so it runs
+// on machines with no GPU, and shows what the software renderer costs), or
+// on video bitmaps of a display when there is one
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <allegro5/allegro.h>
+#include <allegro5/allegro_primitives.h>
+#include "../src/tilemap.h"
+#include "../src/tilecache.h"
+#include "../src/tilemesh.h"
+#include "../src/atlas.h"
+#include "bench.h"
+
+#define TARGET_W        640
+#define TARGET_H        480
+
+// Frames drawn per run, with the camera moving as fast as Luna runs
+#define FRAMES          60
+#define CAMERA_SPEED    6
+
+// Crack frame drawn on every tile
+#define CRACK           6
+
+// Columns of the synthetic levels, and how many tiles each column has
+#define RENDER_COLS     400
+
+static int densities[] = { 4, 8, SYNTH_ROWS };
+
+#define DENSITIES       (sizeof(densities) / sizeof(int))
+
+// Most cells that can be visible at once
+#define MAX_VISIBLE     ((TARGET_W / TILE_SIZE + 2) * (TARGET_H / TILE_SIZE + 2))
+
+static struct
+{
+    ALLEGRO_BITMAP* target;
+    ALLEGRO_BITMAP* tiles;
+    ALLEGRO_BITMAP* cracks;
+    ALLEGRO_BITMAP* walk;
+
+    // Texture (and offset into it) for drawing primitives
+    ALLEGRO_BITMAP* tiles_tex;
+    ALLEGRO_BITMAP* cracks_tex;
+    float tiles_x, tiles_y;
+    float cracks_x, cracks_y;
+
+    ALLEGRO_VERTEX* vtx;
+    struct Tilecache* cache;
+    struct Tilemesh* mesh;
+
+    // NULL when drawing to memory bitmaps
+    ALLEGRO_DISPLAY* display;
+}
+render;
+
+struct Strategy
+{
+    const char* name;
+
+    // Returns 0 if the strategy can't be used
+    int (*begin)(struct Tilemap*);
+    void (*draw)(struct Tilemap*, float x);
+    void (*end)();
+};
+
+// Primitives take a texture and coordinates in it; sub-bitmaps of the
+// atlas are drawn from the atlas itself when the version allows it
+static ALLEGRO_BITMAP* texture_of(ALLEGRO_BITMAP* bmp, float* x, float* y)
+{
+#if ALLEGRO_VERSION_INT >= AL_ID(5, 2, 0, 0)
+    if (al_get_parent_bitmap(bmp) != NULL)
+    {
+        *x = al_get_bitmap_x(bmp);
+        *y = al_get_bitmap_y(bmp);
+        return al_get_parent_bitmap(bmp);
+    }
+#endif
+
+    *x = 0;
+    *y = 0;
+    return bmp;
+}
+
+static int no_begin(struct Tilemap* map)
+{
+    return 1;
+}
+
+static void no_end()
+{
+}
+
+static void draw_player()
+{
+    al_draw_bitmap_region(render.walk, 2 * 48, 0, 48, 47, 300, 380, 0);
+}
+
+// The way on_draw() used to do it: a tile and its crack, cell by cell
+static void draw_regions(struct Tilemap* map, float x)
+{
+    int c, r, col1, row1, col2, row2;
+
+    if (tilemap_get_range(map, x, 0, TARGET_W, TARGET_H, &col1, &row1,
+        &col2, &row2))
+    {
+        for (c=col1; c<=col2; ++c)
+        {
+            for (r=row1; r<=row2; ++r)
+            {
+                int id = tilemap_get(map, c, r);
+
+                if (id == 0)
+                {
+                    continue;
+                }
+
+                al_draw_bitmap_region(render.tiles, map->types[id - 1].left,
+                    map->types[id - 1].top, TILE_SIZE, TILE_SIZE,
+                    c * TILE_SIZE - x, r * TILE_SIZE, 0);
+
+                al_draw_bitmap_region(render.cracks, CRACK * TILE_SIZE, 0,
+                    TILE_SIZE, TILE_SIZE, c * TILE_SIZE - x, r * TILE_SIZE,
+                    0);
+            }
+        }
+    }
+
+    draw_player();
+}
+
+static void draw_held(struct Tilemap* map, float x)
+{
+    al_hold_bitmap_drawing(1);
+    draw_regions(map, x);
+    al_hold_bitmap_drawing(0);
+}
+
+static int prim_begin(struct Tilemap* map)
+{
+    render.vtx = malloc(sizeof(ALLEGRO_VERTEX) * MAX_VISIBLE * 12);
+    return 1;
+}
+
+static void set_quad(ALLEGRO_VERTEX* v, float x, float y, float u, float tv)
+{
+    int i;
+
+    static const int corners[6][2] =
+    {
+        { 0, 0 }, { 1, 0 }, { 0, 1 },
+        { 1, 0 }, { 1, 1 }, { 0, 1 }
+    };
+
+    for (i=0; i<6; ++i)
+    {
+        v[i].x = x + corners[i][0] * TILE_SIZE;
+        v[i].y = y + corners[i][1] * TILE_SIZE;
+        v[i].z = 0;
+        v[i].u = u + corners[i][0] * TILE_SIZE;
+        v[i].v = tv + corners[i][1] * TILE_SIZE;
+        v[i].color = al_map_rgb(255, 255, 255);
+    }
+}
+
+// Every visible cell into one vertex array: tiles first and then cracks,
+// a single call if both come from the same texture
+static void draw_prim(struct Tilemap* map, float x)
+{
+    int c, r, col1, row1, col2, row2, n = 0;
+    ALLEGRO_VERTEX* cracks = render.vtx + MAX_VISIBLE * 6;
+
+    if (tilemap_get_range(map, x, 0, TARGET_W, TARGET_H, &col1, &row1,
+        &col2, &row2))
+    {
+        for (c=col1; c<=col2; ++c)
+        {
+            for (r=row1; r<=row2; ++r)
+            {
+                int id = tilemap_get(map, c, r);
+
+                if (id == 0)
+                {
+                    continue;
+                }
+
+                set_quad(render.vtx + n, c * TILE_SIZE - x, r * TILE_SIZE,
+                    render.tiles_x + map->types[id - 1].left,
+                    render.tiles_y + map->types[id - 1].top);
+
+                set_quad(cracks + n, c * TILE_SIZE - x, r * TILE_SIZE,
+                    render.cracks_x + CRACK * TILE_SIZE, render.cracks_y);
+
+                n += 6;
+            }
+        }
+    }
+
+    if (n > 0)
+    {
+        if (render.tiles_tex == render.cracks_tex)
+        {
+            memmove(render.vtx + n, cracks, sizeof(ALLEGRO_VERTEX) * n);
+            al_draw_prim(render.vtx, NULL, render.tiles_tex, 0, n * 2,
+                ALLEGRO_PRIM_TRIANGLE_LIST);
+        }
+        else
+        {
+            al_draw_prim(render.vtx, NULL, render.tiles_tex, 0, n,
+                ALLEGRO_PRIM_TRIANGLE_LIST);
+            al_draw_prim(cracks, NULL, render.cracks_tex, 0, n,
+                ALLEGRO_PRIM_TRIANGLE_LIST);
+        }
+    }
+
+    draw_player();
+}
+
+static void prim_end()
+{
+    free(render.vtx);
+}
+
+static int cache_begin(struct Tilemap* map)
+{
+    render.cache = create_tilecache(map, render.cracks);
+    tilecache_set_look(render.cache, render.tiles, CRACK);
+    return 1;
+}
+
+static void draw_cache(struct Tilemap* map, float x)
+{
+    al_hold_bitmap_drawing(1);
+    tilecache_draw(render.cache, x, 0, TARGET_W, TARGET_H);
+    draw_player();
+    al_hold_bitmap_drawing(0);
+}
+
+static void cache_end()
+{
+    destroy_tilecache(render.cache);
+}
+
+static int mesh_begin(struct Tilemap* map)
+{
+    // Vertex buffers need a display, so without one they're unsupported
+    if (render.display == NULL)
+    {
+        return 0;
+    }
+
+    render.mesh = create_tilemesh(map);
+
+    if (render.mesh == NULL)
+    {
+        return 0;
+    }
+
+    tilemesh_set_look(render.mesh, render.tiles, render.cracks, CRACK);
+    return 1;
+}
+
+static void draw_mesh(struct Tilemap* map, float x)
+{
+    tilemesh_draw(render.mesh, x, 0, TARGET_W, TARGET_H);
+    draw_player();
+}
+
+static void mesh_end()
+{
+    destroy_tilemesh(render.mesh);
+}
+
+static struct Strategy strategies[] =
+{
+    { "bitmap_region", no_begin, draw_regions, no_end },
+    { "held", no_begin, draw_held, no_end },
+    { "draw_prim", prim_begin, draw_prim, prim_end },
+    { "tilecache", cache_begin, draw_cache, cache_end },
+    { "vertex_buffer", mesh_begin, draw_mesh, mesh_end }
+};
+
+#define STRATEGIES      (sizeof(strategies) / sizeof(struct Strategy))
+
+// Average visible tiles per frame along the camera path
+static int visible_tiles(struct Tilemap* map)
+{
+    int frame, c, r, col1, row1, col2, row2, total = 0;
+
+    for (frame=0; frame<FRAMES; ++frame)
+    {
+        if (tilemap_get_range(map, frame * CAMERA_SPEED, 0, TARGET_W,
+            TARGET_H, &col1, &row1, &col2, &row2))
+        {
+            for (c=col1; c<=col2; ++c)
+            {
+                for (r=row1; r<=row2; ++r)
+                {
+                    if (tilemap_get(map, c, r))
+                    {
+                        ++total;
+                    }
+                }
+            }
+        }
+    }
+
+    return total / FRAMES;
+}
+
+// Video bitmaps are drawn to by the GPU in the background; reading a pixel
+// back waits until it's done, so that time is counted too
+static void finish_drawing()
+{
+    if (render.display != NULL)
+    {
+        al_lock_bitmap_region(render.target, 0, 0, 1, 1,
+            ALLEGRO_PIXEL_FORMAT_ANY, ALLEGRO_LOCK_READONLY);
+        al_unlock_bitmap(render.target);
+    }
+}
+
+static void bench_strategies(struct Tilemap* map, const char* name)
+{
+    int i, run, frame;
+    double times[MAX_RUNS], spent;
+    char params[192];
+
+    snprintf(params, sizeof(params), "\"level\": \"%s\", "
+        "\"visible_tiles\": %d, \"target\": \"%dx%d\", "
+        "\"bitmaps\": \"%s\"", name, visible_tiles(map), TARGET_W,
+        TARGET_H, render.display != NULL ? "video" : "memory");
+
+    for (i=0; i<STRATEGIES; ++i)
+    {
+        char case_name[64];
+
+        sprintf(case_name, "render_%s", strategies[i].name);
+
+        if (!strategies[i].begin(map))
+        {
+            report_unsupported(case_name, params);
+            continue;
+        }
+
+        spent = 0;
+
+        for (run=0; want_run(run, spent); ++run)
+        {
+            double start = al_get_time();
+
+            for (frame=0; frame<FRAMES; ++frame)
+            {
+                float x = frame * CAMERA_SPEED;
+
+                tilemap_stream(map, x, TARGET_W, CAMERA_SPEED);
+
+                al_set_target_bitmap(render.target);
+                al_clear_to_color(al_map_rgb(192, 192, 192));
+                strategies[i].draw(map, x);
+            }
+
+            finish_drawing();
+
+            times[run] = (al_get_time() - start) / FRAMES;
+            spent += times[run] * FRAMES;
+        }
+
+        report(case_name, params, times, run);
+
+        strategies[i].end();
+    }
+}
+
+static void end_display()
+{
+    if (render.display != NULL)
+    {
+        al_set_new_bitmap_flags(ALLEGRO_MEMORY_BITMAP);
+        al_destroy_display(render.display);
+        render.display = NULL;
+    }
+}
+
+void bench_render(struct Tilemap* shipped, int display)
+{
+    int i;
+    struct Level_Text text;
+    struct Tilemap* map;
+
+    render.display = NULL;
+
+    // Everything (atlas included) then goes to video bitmaps
+    if (display)
+    {
+        render.display = al_create_display(TARGET_W, TARGET_H);
+
+        if (render.display == NULL)
+        {
+            fprintf(stderr, "WARNING: Could not create a display, drawing "
+                "to memory bitmaps\n");
+        }
+        else
+        {
+            al_set_new_bitmap_flags(ALLEGRO_VIDEO_BITMAP);
+        }
+    }
+
+    if (!al_init_primitives_addon() || !create_atlas())
+    {
+        fprintf(stderr, "ERROR: Could not set up drawing\n");
+        end_display();
+        return;
+    }
+
+    render.target = al_create_bitmap(TARGET_W, TARGET_H);
+    render.tiles = atlas_get(ATLAS_TILES);
+    render.cracks = atlas_get(ATLAS_CRACKS);
+    render.walk = atlas_get(ATLAS_TROTTING);
+
+    render.tiles_tex = texture_of(render.tiles, &render.tiles_x,
+        &render.tiles_y);
+    render.cracks_tex = texture_of(render.cracks, &render.cracks_x,
+        &render.cracks_y);
+
+    bench_strategies(shipped, "shipped");
+
+    for (i=0; i<DENSITIES; ++i)
+    {
+        char name[32];
+
+        memset(&text, 0, sizeof(text));
+        synthetic_level_txt(shipped, RENDER_COLS * densities[i],
+            densities[i], &text);
+        map = level_from_txt(&text);
+        free(text.data);
+
+        sprintf(name, "synthetic-%d-per-column", densities[i]);
+        bench_strategies(map, name);
+
+        destroy_tilemap(map);
+    }
+
+    al_destroy_bitmap(render.target);
+    destroy_atlas();
+    end_display();
+}
@@ -0,0 +1,226 @@
+// Batch bounding box tests, with SSE2/AVX2 versions on x86
+
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include "aabb.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HAVE_X86_SIMD
+#include <immintrin.h>
+#endif
+
+// Boxes are stored in groups of this many (the widest vector), the unused
+// ones at the end can never be hit
+#define GROUP   8
+
+typedef int (*Test_Func)(struct AABB_Store*, float, float, float, float,
+    unsigned int*);
+
+void aabb_init(struct AABB_Store* s)
+{
+    s->x1 = s->y1 = s->x2 = s->y2 = NULL;
+    s->count = s->max = 0;
+}
+
+void aabb_free(struct AABB_Store* s)
+{
+    free(s->x1);
+    free(s->y1);
+    free(s->x2);
+    free(s->y2);
+    aabb_init(s);
+}
+
+void aabb_clear(struct AABB_Store* s)
+{
+    s->count = 0;
+}
+
+void aabb_add(struct AABB_Store* s, float x, float y, float w, float h)
+{
+    int i;
+
+    if (s->count == s->max)
+    {
+        s->max = (s->max ? s->max * 2 : GROUP * 4);
+        s->x1 = realloc(s->x1, sizeof(float) * s->max);
+        s->y1 = realloc(s->y1, sizeof(float) * s->max);
+        s->x2 = realloc(s->x2, sizeof(float) * s->max);
+        s->y2 = realloc(s->y2, sizeof(float) * s->max);
+    }
+
+    s->x1[s->count] = x;
+    s->y1[s->count] = y;
+    s->x2[s->count] = x + w;
+    s->y2[s->count] = y + h;
+    ++s->count;
+
+    // Padding up to the next group
+    for (i=s->count; i % GROUP; ++i)
+    {
+        s->x1[i] = s->y1[i] = FLT_MAX;
+        s->x2[i] = s->y2[i] = -FLT_MAX;
+    }
+}
+
+static int test_scalar(struct AABB_Store* s, float x, float y, float w,
+  float h, unsigned int* mask)
+{
+    int i, hits = 0;
+
+    memset(mask, 0, sizeof(unsigned int) * ((s->count + 31) / 32));
+
+    for (i=0; i<s->count; ++i)
+    {
+        if (x < s->x2[i] && s->x1[i] < x + w
+            && y < s->y2[i] && s->y1[i] < y + h)
+        {
+            mask[i / 32] |= 1u << (i % 32);
+            ++hits;
+        }
+    }
+
+    return hits;
+}
+
+#ifdef HAVE_X86_SIMD
+
+__attribute__((target("sse2")))
+static int test_sse2(struct AABB_Store* s, float x, float y, float w,
+  float h, unsigned int* mask)
+{
+    int i, hits = 0;
+    __m128 qx1 = _mm_set1_ps(x), qx2 = _mm_set1_ps(x + w);
+    __m128 qy1 = _mm_set1_ps(y), qy2 = _mm_set1_ps(y + h);
+
+    memset(mask, 0, sizeof(unsigned int) * ((s->count + 31) / 32));
+
+    for (i=0; i<s->count; i+=4)
+    {
+        __m128 hit = _mm_and_ps(
+            _mm_and_ps(_mm_cmplt_ps(qx1, _mm_loadu_ps(s->x2 + i)),
+                _mm_cmplt_ps(_mm_loadu_ps(s->x1 + i), qx2)),
+            _mm_and_ps(_mm_cmplt_ps(qy1, _mm_loadu_ps(s->y2 + i)),
+                _mm_cmplt_ps(_mm_loadu_ps(s->y1 + i), qy2)));
+
+        unsigned int bits = _mm_movemask_ps(hit);
+
+        if (bits)
+        {
+            mask[i / 32] |= bits << (i % 32);
+            hits += __builtin_popcount(bits);
+        }
+    }
+
+    return hits;
+}
+
+__attribute__((target("avx2")))
+static int test_avx2(struct AABB_Store* s, float x, float y, float w,
+  float h, unsigned int* mask)
+{
+    int i, hits = 0;
+    __m256 qx1 = _mm256_set1_ps(x), qx2 = _mm256_set1_ps(x + w);
+    __m256 qy1 = _mm256_set1_ps(y), qy2 = _mm256_set1_ps(y + h);
+
+    memset(mask, 0, sizeof(unsigned int) * ((s->count + 31) / 32));
+
+    for (i=0; i<s->count; i+=8)
+    {
+        __m256 hit = _mm256_and_ps(
+            _mm256_and_ps(
+                _mm256_cmp_ps(qx1, _mm256_loadu_ps(s->x2 + i), _CMP_LT_OQ),
+                _mm256_cmp_ps(_mm256_loadu_ps(s->x1 + i), qx2, _CMP_LT_OQ)),
+            _mm256_and_ps(
+                _mm256_cmp_ps(qy1, _mm256_loadu_ps(s->y2 + i), _CMP_LT_OQ),
+                _mm256_cmp_ps(_mm256_loadu_ps(s->y1 + i), qy2, _CMP_LT_OQ)));
+
+        unsigned int bits = _mm256_movemask_ps(hit);
+
+        if (bits)
+        {
+            mask[i / 32] |= bits << (i % 32);
+            hits += __builtin_popcount(bits);
+        }
+    }
+
+    return hits;
+}
+
+#endif
+
+static Test_Func impls[AABB_IMPL_COUNT] =
+{
+    test_scalar,
+#ifdef HAVE_X86_SIMD
+    test_sse2,
+    test_avx2
+#else
+    NULL,
+    NULL
+#endif
+};
+
+static Test_Func current = NULL;
+
+static int supported(int impl)
+{
+    if (impl < 0 || impl >= AABB_IMPL_COUNT || impls[impl] == NULL)
+    {
+        return 0;
+    }
+
+#ifdef HAVE_X86_SIMD
+    __builtin_cpu_init();
+
+    if (impl == AABB_SSE2)
+    {
+        return __builtin_cpu_supports("sse2");
+    }
+
+    if (impl == AABB_AVX2)
+    {
+        return __builtin_cpu_supports("avx2");
+    }
+#endif
+
+    return 1;
+}
+
+int aabb_test(struct AABB_Store* s, float x, float y, float w, float h,
+  unsigned int* mask)
+{
+    // First use: the widest one this CPU can run
+    if (current == NULL)
+    {
+        int i = AABB_IMPL_COUNT - 1;
+
+        while (!supported(i))
+        {
+            --i;
+        }
+
+        current = impls[i];
+    }
+
+    return current(s, x, y, w, h, mask);
+}
+
+int aabb_select(int impl)
+{
+    if (!supported(impl))
+    {
+        return 0;
+    }
+
+    current = impls[impl];
+    return 1;
+}
+
+const char* aabb_impl_name(int impl)
+{
+    static const char* names[AABB_IMPL_COUNT] = { "scalar", "sse2", "avx2" };
+
+    return names[impl];
+}
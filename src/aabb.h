@@ -0,0 +1,39 @@
+#ifndef AABB_H_INCLUDED
+#define AABB_H_INCLUDED
+
+// Bounding boxes stored as separate arrays (structure of arrays), so many
+// of them can be tested against one box at once
+struct AABB_Store
+{
+    float* x1;
+    float* y1;
+    float* x2;
+    float* y2;
+    int count, max;
+};
+
+// Implementations of aabb_test(), the best one is picked at run-time
+enum
+{
+    AABB_SCALAR,
+    AABB_SSE2,
+    AABB_AVX2,
+    AABB_IMPL_COUNT
+};
+
+void aabb_init(struct AABB_Store*);
+void aabb_free(struct AABB_Store*);
+void aabb_clear(struct AABB_Store*);
+void aabb_add(struct AABB_Store*, float x, float y, float w, float h);
+
+// Tests every box against a single one, same as check_bb_collision()
+// Box N hits if bit N % 32 of mask[N / 32] is set (mask needs room for
+// (count + 31) / 32 words). Returns how many boxes were hit.
+int aabb_test(struct AABB_Store*, float x, float y, float w, float h,
+    unsigned int* mask);
+
+// Forces an implementation, returns 0 if this CPU can't run it
+int aabb_select(int impl);
+const char* aabb_impl_name(int impl);
+
+#endif // AABB_H_INCLUDED
@@ -0,0 +1,159 @@
+// Single texture holding every image used in the game state, so drawing
+// can be held (batched) without switching textures
+
+#include <stdio.h>
+#include <allegro5/allegro.h>
+#include "atlas.h"
+#include "game.h"
+
+#include "data/main_gfx.h"
+#include "data/sprites.h"
+
+// Width of the atlas, and space left around each image so scaling doesn't
+// bleed from its neighbors
+#define ATLAS_W     1024
+#define PADDING     2
+
+static struct
+{
+    void* data;
+    unsigned int* length;
+}
+sources[ATLAS_COUNT] =
+{
+    { bg_tga_data, &bg_tga_length },
+    { tiles_tga_data, &tiles_tga_length },
+    { tilesred_tga_data, &tilesred_tga_length },
+    { cracks_tga_data, &cracks_tga_length },
+    { text_tga_data, &text_tga_length },
+    { stand_tga_data, &stand_tga_length },
+    { trotting_tga_data, &trotting_tga_length },
+    { flying_tga_data, &flying_tga_length }
+};
+
+static ALLEGRO_BITMAP* atlas = NULL;
+
+// Lookup table of sub-bitmaps
+static ALLEGRO_BITMAP* images[ATLAS_COUNT];
+
+int create_atlas()
+{
+    int i, j, x, y, shelf_h, atlas_h;
+    int order[ATLAS_COUNT], px[ATLAS_COUNT], py[ATLAS_COUNT];
+    ALLEGRO_BITMAP* loaded[ATLAS_COUNT];
+    ALLEGRO_BITMAP* target = al_get_target_bitmap();
+    int flags = al_get_new_bitmap_flags();
+    int op, src, dst;
+
+    // Decode everything in memory first
+    al_set_new_bitmap_flags(ALLEGRO_MEMORY_BITMAP);
+
+    for (i=0; i<ATLAS_COUNT; ++i)
+    {
+        loaded[i] = bitmap_from_data(sources[i].data, *sources[i].length, ".tga");
+
+        if (loaded[i] == NULL)
+        {
+            printf("ERROR: Could not decode atlas image %d\n", i);
+
+            while (--i >= 0)
+            {
+                al_destroy_bitmap(loaded[i]);
+            }
+
+            al_set_new_bitmap_flags(flags);
+            return 0;
+        }
+
+        order[i] = i;
+    }
+
+    al_set_new_bitmap_flags(flags);
+
+    // Tallest images first, then pack them in shelves
+    for (i=1; i<ATLAS_COUNT; ++i)
+    {
+        for (j=i; j>0 && al_get_bitmap_height(loaded[order[j]])
+            > al_get_bitmap_height(loaded[order[j - 1]]); --j)
+        {
+            int t = order[j];
+            order[j] = order[j - 1];
+            order[j - 1] = t;
+        }
+    }
+
+    x = y = shelf_h = 0;
+
+    for (i=0; i<ATLAS_COUNT; ++i)
+    {
+        int w = al_get_bitmap_width(loaded[order[i]]) + PADDING;
+        int h = al_get_bitmap_height(loaded[order[i]]) + PADDING;
+
+        if (x + w > ATLAS_W)
+        {
+            x = 0;
+            y += shelf_h;
+            shelf_h = 0;
+        }
+
+        px[order[i]] = x;
+        py[order[i]] = y;
+
+        x += w;
+
+        if (h > shelf_h)
+        {
+            shelf_h = h;
+        }
+    }
+
+    // Power of two, just in case
+    atlas_h = 1;
+
+    while (atlas_h < y + shelf_h)
+    {
+        atlas_h *= 2;
+    }
+
+    atlas = al_create_bitmap(ATLAS_W, atlas_h);
+
+    al_get_blender(&op, &src, &dst);
+    al_set_target_bitmap(atlas);
+    al_clear_to_color(al_map_rgba(0, 0, 0, 0));
+
+    // Copy pixels as they are
+    al_set_blender(ALLEGRO_ADD, ALLEGRO_ONE, ALLEGRO_ZERO);
+
+    for (i=0; i<ATLAS_COUNT; ++i)
+    {
+        al_draw_bitmap(loaded[i], px[i], py[i], 0);
+
+        images[i] = al_create_sub_bitmap(atlas, px[i], py[i],
+            al_get_bitmap_width(loaded[i]), al_get_bitmap_height(loaded[i]));
+
+        al_destroy_bitmap(loaded[i]);
+    }
+
+    al_set_blender(op, src, dst);
+    al_set_target_bitmap(target);
+
+    return 1;
+}
+
+void destroy_atlas()
+{
+    int i;
+
+    for (i=0; i<ATLAS_COUNT; ++i)
+    {
+        al_destroy_bitmap(images[i]);
+    }
+
+    al_destroy_bitmap(atlas);
+    atlas = NULL;
+}
+
+ALLEGRO_BITMAP* atlas_get(int image)
+{
+    return images[image];
+}
@@ -0,0 +1,27 @@
+#ifndef ATLAS_H_INCLUDED
+#define ATLAS_H_INCLUDED
+
+#include <allegro5/allegro.h>
+
+// Every image packed in the atlas
+enum
+{
+    ATLAS_BG,
+    ATLAS_TILES,
+    ATLAS_TILESRED,
+    ATLAS_CRACKS,
+    ATLAS_TEXT,
+    ATLAS_STAND,
+    ATLAS_TROTTING,
+    ATLAS_FLYING,
+    ATLAS_COUNT
+};
+
+// Packs the embedded game images into a single texture
+int create_atlas();
+void destroy_atlas();
+
+// Sub-bitmap of the atlas (don't destroy it)
+ALLEGRO_BITMAP* atlas_get(int image);
+
+#endif // ATLAS_H_INCLUDED
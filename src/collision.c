@@ -0,0 +1,247 @@
+// Swept box vs. level collision, solved one axis at a time against tiles
+// merged into big rectangles
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "collision.h"
+#include "tilemap.h"
+#include "aabb.h"
+
+// How much the swept box is grown to find colliders it only touches (the
+// distances are exact, this only lets more colliders be checked)
+#define SWEEP_MARGIN    1.0f
+
+struct Chunk_Colliders
+{
+    // Chunk these were merged from (-1 for none)
+    int index;
+
+    struct AABB_Store boxes;
+};
+
+struct Colliders
+{
+    struct Tilemap* map;
+
+    // Same slots as the chunks in the tilemap
+    struct Chunk_Colliders chunks[MAX_CHUNKS];
+
+    // Hit mask for a whole chunk (one bit per collider)
+    unsigned int* mask;
+};
+
+struct Colliders* create_colliders(struct Tilemap* map)
+{
+    int i;
+    struct Colliders* c = malloc(sizeof(struct Colliders));
+
+    c->map = map;
+    c->mask = malloc(sizeof(unsigned int)
+        * ((CHUNK_COLS * map->rows + 31) / 32 + 1));
+
+    for (i=0; i<MAX_CHUNKS; ++i)
+    {
+        c->chunks[i].index = -1;
+        aabb_init(&c->chunks[i].boxes);
+    }
+
+    return c;
+}
+
+void destroy_colliders(struct Colliders* c)
+{
+    int i;
+
+    for (i=0; i<MAX_CHUNKS; ++i)
+    {
+        aabb_free(&c->chunks[i].boxes);
+    }
+
+    free(c->mask);
+    free(c);
+}
+
+// Solid cell of a chunk that hasn't been merged yet
+static int free_cell(struct Tilemap* map, unsigned char* used, int index,
+  int col, int row)
+{
+    return !used[col * map->rows + row]
+        && tilemap_get(map, index * CHUNK_COLS + col, row);
+}
+
+// Greedy merge: grow each rectangle to the right as far as it goes, then
+// down while the whole row below is solid too
+static void merge_chunk(struct Tilemap* map, struct Chunk_Colliders* cc,
+  int index)
+{
+    int i, j, w, h, k;
+    int rows = map->rows;
+    int first = index * CHUNK_COLS;
+    unsigned char* used = calloc(CHUNK_COLS * rows, 1);
+
+    aabb_clear(&cc->boxes);
+
+    for (j=0; j<rows; ++j)
+    {
+        for (i=0; i<CHUNK_COLS; ++i)
+        {
+            if (!free_cell(map, used, index, i, j))
+            {
+                continue;
+            }
+
+            w = 1;
+
+            while (i + w < CHUNK_COLS && free_cell(map, used, index, i + w, j))
+            {
+                ++w;
+            }
+
+            for (h=1; j + h < rows; ++h)
+            {
+                for (k=0; k<w; ++k)
+                {
+                    if (!free_cell(map, used, index, i + k, j + h))
+                    {
+                        break;
+                    }
+                }
+
+                if (k < w)
+                {
+                    break;
+                }
+            }
+
+            for (k=0; k<w * h; ++k)
+            {
+                used[(i + k % w) * rows + j + k / w] = 1;
+            }
+
+            aabb_add(&cc->boxes, (first + i) * TILE_SIZE, j * TILE_SIZE,
+                w * TILE_SIZE, h * TILE_SIZE);
+        }
+    }
+
+    cc->index = index;
+
+    free(used);
+}
+
+struct AABB_Store* get_colliders(struct Colliders* c, int chunk)
+{
+    struct Chunk_Colliders* cc = &c->chunks[chunk % MAX_CHUNKS];
+
+    if (cc->index != chunk)
+    {
+        merge_chunk(c->map, cc, chunk);
+    }
+
+    return &cc->boxes;
+}
+
+// How far a box can go along one axis (dx or dy, the other one is 0)
+// before touching a collider
+static float sweep(struct Colliders* c, float x, float y, float w, float h,
+  float dx, float dy, int* hit)
+{
+    int i, j, chunk1, chunk2;
+    float move = (dx != 0 ? dx : dy);
+    float x1 = x + (dx < 0 ? dx : 0);
+    float x2 = x + w + (dx > 0 ? dx : 0);
+    float y1 = y + (dy < 0 ? dy : 0);
+    float y2 = y + h + (dy > 0 ? dy : 0);
+
+    *hit = 0;
+
+    if (move == 0 || c->map->cols == 0)
+    {
+        return 0;
+    }
+
+    // aabb_test() only finds boxes that overlap, so the swept box is grown
+    // along the move to find the ones it ends up flush against too
+    if (dx != 0)
+    {
+        x1 -= SWEEP_MARGIN;
+        x2 += SWEEP_MARGIN;
+    }
+    else
+    {
+        y1 -= SWEEP_MARGIN;
+        y2 += SWEEP_MARGIN;
+    }
+
+    // Chunks the swept box goes through
+    chunk1 = floor(x1 / (CHUNK_COLS * TILE_SIZE));
+    chunk2 = floor(x2 / (CHUNK_COLS * TILE_SIZE));
+
+    if (chunk1 < 0)
+    {
+        chunk1 = 0;
+    }
+
+    if (chunk2 > (c->map->cols - 1) / CHUNK_COLS)
+    {
+        chunk2 = (c->map->cols - 1) / CHUNK_COLS;
+    }
+
+    for (i=chunk1; i<=chunk2; ++i)
+    {
+        struct AABB_Store* boxes = get_colliders(c, i);
+
+        // Only the colliders touching the swept box can be in the way
+        if (aabb_test(boxes, x1, y1, x2 - x1, y2 - y1, c->mask) == 0)
+        {
+            continue;
+        }
+
+        for (j=0; j<boxes->count; ++j)
+        {
+            float dist;
+
+            if (!(c->mask[j / 32] & (1u << (j % 32))))
+            {
+                continue;
+            }
+
+            if (dx != 0)
+            {
+                dist = (dx > 0 ? boxes->x1[j] - (x + w) : boxes->x2[j] - x);
+            }
+            else
+            {
+                dist = (dy > 0 ? boxes->y1[j] - (y + h) : boxes->y2[j] - y);
+            }
+
+            // Behind the box (or already overlapping it)
+            if ((move > 0 && dist < 0) || (move < 0 && dist > 0))
+            {
+                continue;
+            }
+
+            if (fabs(dist) <= fabs(move))
+            {
+                move = dist;
+                *hit = 1;
+            }
+        }
+    }
+
+    return move;
+}
+
+void move_box(struct Colliders* c, float* x, float* y, float w, float h,
+  float dx, float dy, struct Contact* contact)
+{
+    int hit;
+
+    *x += sweep(c, *x, *y, w, h, dx, 0, &hit);
+    contact->wall_left = (hit && dx < 0);
+    contact->wall_right = (hit && dx > 0);
+
+    *y += sweep(c, *x, *y, w, h, 0, dy, &hit);
+    contact->grounded = (hit && dy > 0);
+    contact->ceiling = (hit && dy < 0);
+}
@@ -0,0 +1,31 @@
+#ifndef COLLISION_H_INCLUDED
+#define COLLISION_H_INCLUDED
+
+struct Tilemap;
+struct AABB_Store;
+
+// Colliders for every loaded chunk (tiles are never merged across chunks)
+struct Colliders;
+
+// What a moving box ran into
+struct Contact
+{
+    int grounded;
+    int ceiling;
+    int wall_left;
+    int wall_right;
+};
+
+struct Colliders* create_colliders(struct Tilemap*);
+void destroy_colliders(struct Colliders*);
+
+// Colliders of a chunk (solid tiles merged into big rectangles), made the
+// first time they're needed
+struct AABB_Store* get_colliders(struct Colliders*, int chunk);
+
+// Moves a box by dx and then by dy, stopping right before the first solid
+// tile on each axis (no matter how fast it goes)
+void move_box(struct Colliders*, float* x, float* y, float w, float h,
+    float dx, float dy, struct Contact*);
+
+#endif // COLLISION_H_INCLUDED
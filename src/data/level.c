@@ -1,1392 +1,94 @@
 /*
-  level.txt
-  34547 bytes
+  level.lvl
+  3196 bytes
 */
 
-unsigned int level_txt_length = 34547;
-unsigned char level_txt_data[34547] =
+unsigned int level_lvl_length = 3196;
+unsigned char level_lvl_data[3196] =
 {
-  49,32,57,54,32,48,32,51,50,32,51,50,32,48,32,48,13,10,49,32,57,54,32,51,50,
-  32,51,50,32,51,50,32,48,32,51,50,13,10,49,32,57,54,32,51,50,32,51,50,32,51,
-  50,32,48,32,54,52,13,10,49,32,57,54,32,51,50,32,51,50,32,51,50,32,48,32,57,
-  54,13,10,49,32,57,54,32,51,50,32,51,50,32,51,50,32,48,32,49,50,56,13,10,49,
-  32,57,54,32,51,50,32,51,50,32,51,50,32,48,32,49,54,48,13,10,49,32,57,54,32,
-  51,50,32,51,50,32,51,50,32,48,32,49,57,50,13,10,49,32,57,54,32,51,50,32,51,
-  50,32,51,50,32,48,32,50,50,52,13,10,49,32,48,32,51,50,32,51,50,32,51,50,32,
-  48,32,50,53,54,13,10,49,32,48,32,51,50,32,51,50,32,51,50,32,48,32,50,56,56,
-  13,10,49,32,48,32,51,50,32,51,50,32,51,50,32,48,32,51,50,48,13,10,49,32,48,
-  32,51,50,32,51,50,32,51,50,32,48,32,51,53,50,13,10,49,32,48,32,51,50,32,51,
-  50,32,51,50,32,48,32,51,56,52,13,10,49,32,48,32,51,50,32,51,50,32,51,50,32,
-  48,32,52,49,54,13,10,49,32,48,32,54,52,32,51,50,32,51,50,32,48,32,52,52,56,
-  13,10,49,32,54,52,32,48,32,51,50,32,51,50,32,51,50,32,50,53,54,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,51,50,32,50,56,56,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,51,50,48,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,51,50,32,
-  52,52,56,13,10,49,32,54,52,32,48,32,51,50,32,51,50,32,54,52,32,50,56,56,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,32,51,50,48,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,54,52,32,51,53,50,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,54,52,32,51,56,52,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,54,52,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,
-  51,50,32,54,52,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,57,
-  54,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,57,54,32,51,
-  53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,57,54,32,51,56,52,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,57,54,32,52,49,54,13,10,49,32,
-  51,50,32,54,52,32,51,50,32,51,50,32,57,54,32,52,52,56,13,10,49,32,51,50,32,
-  48,32,51,50,32,51,50,32,49,50,56,32,51,50,48,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,49,50,56,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,49,50,56,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,49,50,56,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,
-  49,50,56,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,49,54,48,
-  32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,54,48,32,51,
-  53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,54,48,32,51,56,52,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,54,48,32,52,49,54,13,10,
-  49,32,51,50,32,54,52,32,51,50,32,51,50,32,49,54,48,32,52,52,56,13,10,49,32,
-  48,32,48,32,51,50,32,51,50,32,49,57,50,32,50,56,56,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,49,57,50,32,51,50,48,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,49,57,50,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,49,57,50,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,49,57,50,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,
-  49,57,50,32,52,52,56,13,10,49,32,48,32,48,32,51,50,32,51,50,32,50,50,52,32,
-  50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,50,52,32,50,56,
-  56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,50,52,32,51,50,48,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,50,52,32,51,53,50,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,50,50,52,32,51,56,52,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,50,50,52,32,52,49,54,13,10,49,32,51,50,32,
-  54,52,32,51,50,32,51,50,32,50,50,52,32,52,52,56,13,10,49,32,48,32,48,32,51,
-  50,32,51,50,32,50,53,54,32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,50,53,54,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,50,53,54,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,
-  53,54,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,53,54,
-  32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,53,54,32,51,
-  56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,53,54,32,52,49,54,
-  13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,50,53,54,32,52,52,56,13,10,
-  49,32,51,50,32,48,32,51,50,32,51,50,32,50,56,56,32,50,50,52,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,50,56,56,32,50,53,54,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,50,56,56,32,50,56,56,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,50,56,56,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,50,56,56,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,50,56,56,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,50,56,56,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,50,
-  56,56,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,51,50,48,32,
-  50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,50,48,32,50,53,
-  54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,50,48,32,50,56,56,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,50,48,32,51,50,48,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,51,50,48,32,51,53,50,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,51,50,48,32,51,56,52,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,51,50,48,32,52,49,54,13,10,49,32,51,50,32,54,52,
-  32,51,50,32,51,50,32,51,50,48,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,
-  32,51,50,32,51,53,50,32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,51,53,50,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  51,53,50,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,53,
-  50,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,53,50,32,
-  51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,53,50,32,51,56,
-  52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,53,50,32,52,49,54,13,
-  10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,51,53,50,32,52,52,56,13,10,49,
-  32,51,50,32,48,32,51,50,32,51,50,32,51,56,52,32,50,50,52,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,51,56,52,32,50,53,54,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,51,56,52,32,50,56,56,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,51,56,52,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,51,56,52,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,51,56,52,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  51,56,52,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,51,56,
-  52,32,52,52,56,13,10,49,32,48,32,48,32,51,50,32,51,50,32,52,49,54,32,49,57,
-  50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,49,54,32,50,50,52,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,49,54,32,50,53,54,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,52,49,54,32,50,56,56,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,52,49,54,32,51,50,48,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,52,49,54,32,51,53,50,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,52,49,54,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,52,49,54,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,
-  51,50,32,52,49,54,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,
-  52,52,56,32,49,57,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,52,
-  56,32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,52,56,32,
-  50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,52,56,32,50,56,
-  56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,52,56,32,51,50,48,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,52,56,32,51,53,50,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,52,52,56,32,51,56,52,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,52,52,56,32,52,49,54,13,10,49,32,51,50,32,
-  54,52,32,51,50,32,51,50,32,52,52,56,32,52,52,56,13,10,49,32,51,50,32,48,32,
-  51,50,32,51,50,32,52,56,48,32,49,57,50,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,52,56,48,32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,52,56,48,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  52,56,48,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,56,
-  48,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,56,48,32,
-  51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,56,48,32,51,56,
-  52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,56,48,32,52,49,54,13,
-  10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,52,56,48,32,52,52,56,13,10,49,
-  32,51,50,32,48,32,51,50,32,51,50,32,53,49,50,32,49,57,50,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,53,49,50,32,50,50,52,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,53,49,50,32,50,53,54,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,53,49,50,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,53,49,50,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,53,49,50,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  53,49,50,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,49,
-  50,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,53,49,50,32,
-  52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,53,52,52,32,49,57,50,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,52,52,32,50,50,52,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,52,52,32,50,53,54,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,53,52,52,32,50,56,56,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,53,52,52,32,51,50,48,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,53,52,52,32,51,53,50,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,53,52,52,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,53,52,52,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,
-  50,32,53,52,52,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,53,
-  55,54,32,49,57,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,55,54,
-  32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,55,54,32,50,
-  53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,55,54,32,50,56,56,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,55,54,32,51,50,48,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,55,54,32,51,53,50,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,53,55,54,32,51,56,52,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,53,55,54,32,52,49,54,13,10,49,32,51,50,32,54,
-  52,32,51,50,32,51,50,32,53,55,54,32,52,52,56,13,10,49,32,54,52,32,48,32,51,
-  50,32,51,50,32,54,48,56,32,49,57,50,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,54,48,56,32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,54,48,56,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,
-  48,56,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,48,56,
-  32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,48,56,32,51,
-  53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,48,56,32,51,56,52,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,48,56,32,52,49,54,13,10,
-  49,32,51,50,32,54,52,32,51,50,32,51,50,32,54,48,56,32,52,52,56,13,10,49,32,
-  54,52,32,48,32,51,50,32,51,50,32,54,52,48,32,50,50,52,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,54,52,48,32,50,53,54,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,54,52,48,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,54,52,48,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,54,52,48,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,54,52,48,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,
-  52,48,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,54,52,48,
-  32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,54,55,50,32,50,53,
-  54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,55,50,32,50,56,56,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,55,50,32,51,50,48,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,54,55,50,32,51,53,50,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,54,55,50,32,51,56,52,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,54,55,50,32,52,49,54,13,10,49,32,51,50,32,54,52,
-  32,51,50,32,51,50,32,54,55,50,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,
-  32,51,50,32,55,48,52,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,55,48,52,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  55,48,52,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,55,48,
-  52,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,55,48,52,32,
-  51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,55,48,52,32,52,49,
-  54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,55,48,52,32,52,52,56,13,
-  10,49,32,54,52,32,48,32,51,50,32,51,50,32,55,51,54,32,50,53,54,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,55,51,54,32,50,56,56,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,55,51,54,32,51,50,48,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,55,51,54,32,51,53,50,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,55,51,54,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,55,51,54,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,
-  50,32,55,51,54,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,55,
-  54,56,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,55,54,56,
-  32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,55,54,56,32,51,
-  53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,55,54,56,32,51,56,52,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,55,54,56,32,52,49,54,13,10,
-  49,32,51,50,32,54,52,32,51,50,32,51,50,32,55,54,56,32,52,52,56,13,10,49,32,
-  51,50,32,48,32,51,50,32,51,50,32,56,48,48,32,50,56,56,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,56,48,48,32,51,50,48,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,56,48,48,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,56,48,48,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,56,48,48,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,
-  32,56,48,48,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,56,51,
-  50,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,56,51,50,32,
-  51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,56,51,50,32,51,53,
-  50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,56,51,50,32,51,56,52,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,56,51,50,32,52,49,54,13,10,49,
-  32,51,50,32,54,52,32,51,50,32,51,50,32,56,51,50,32,52,52,56,13,10,49,32,51,
-  50,32,48,32,51,50,32,51,50,32,56,54,52,32,50,56,56,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,56,54,52,32,51,50,48,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,56,54,52,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,56,54,52,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,56,54,52,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,
-  56,54,52,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,56,57,54,
-  32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,56,57,54,32,51,
-  50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,56,57,54,32,51,53,50,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,56,57,54,32,51,56,52,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,56,57,54,32,52,49,54,13,10,49,32,
-  51,50,32,54,52,32,51,50,32,51,50,32,56,57,54,32,52,52,56,13,10,49,32,51,50,
-  32,48,32,51,50,32,51,50,32,57,50,56,32,50,56,56,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,57,50,56,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,57,50,56,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,57,50,56,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,57,50,56,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,57,
-  50,56,32,52,52,56,13,10,49,32,54,52,32,48,32,51,50,32,51,50,32,57,54,48,32,
-  50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,57,54,48,32,51,50,
-  48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,57,54,48,32,51,53,50,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,57,54,48,32,51,56,52,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,57,54,48,32,52,49,54,13,10,49,32,51,
-  50,32,54,52,32,51,50,32,51,50,32,57,54,48,32,52,52,56,13,10,49,32,51,50,32,
-  48,32,51,50,32,51,50,32,57,57,50,32,51,50,48,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,57,57,50,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,57,57,50,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,57,57,50,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,
-  57,57,50,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,49,48,50,
-  52,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,48,50,52,
-  32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,48,50,52,32,
-  51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,48,50,52,32,52,
-  49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,49,48,50,52,32,52,52,
-  56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,49,48,53,54,32,51,50,48,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,48,53,54,32,51,53,50,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,48,53,54,32,51,56,52,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,49,48,53,54,32,52,49,54,13,10,49,32,
-  51,50,32,54,52,32,51,50,32,51,50,32,49,48,53,54,32,52,52,56,13,10,49,32,51,
-  50,32,48,32,51,50,32,51,50,32,49,48,56,56,32,51,50,48,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,49,48,56,56,32,51,53,50,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,49,48,56,56,32,51,56,52,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,49,48,56,56,32,52,49,54,13,10,49,32,51,50,32,54,52,32,
-  51,50,32,51,50,32,49,48,56,56,32,52,52,56,13,10,49,32,48,32,48,32,51,50,32,
-  51,50,32,49,49,50,48,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,49,49,50,48,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,49,49,50,48,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  49,49,50,48,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,
-  49,50,48,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,49,49,
-  50,48,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,49,49,53,50,
-  32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,49,53,50,32,
-  51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,49,53,50,32,51,
-  53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,49,53,50,32,51,56,
-  52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,49,53,50,32,52,49,54,
-  13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,49,49,53,50,32,52,52,56,13,
-  10,49,32,51,50,32,48,32,51,50,32,51,50,32,49,49,56,52,32,50,56,56,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,49,49,56,52,32,51,50,48,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,49,49,56,52,32,51,53,50,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,49,49,56,52,32,51,56,52,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,49,49,56,52,32,52,49,54,13,10,49,32,51,50,32,
-  54,52,32,51,50,32,51,50,32,49,49,56,52,32,52,52,56,13,10,49,32,54,52,32,48,
-  32,51,50,32,51,50,32,49,50,49,54,32,50,56,56,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,49,50,49,54,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,49,50,49,54,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,49,50,49,54,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,49,50,49,54,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,
-  50,32,49,50,49,54,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,
-  49,50,52,56,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,
-  50,52,56,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,50,
-  52,56,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,50,52,
-  56,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,49,50,52,56,
-  32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,49,50,56,48,32,51,
-  50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,50,56,48,32,51,53,
-  50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,50,56,48,32,51,56,52,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,50,56,48,32,52,49,54,13,
-  10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,49,50,56,48,32,52,52,56,13,10,
-  49,32,51,50,32,48,32,51,50,32,51,50,32,49,51,49,50,32,51,50,48,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,49,51,49,50,32,51,53,50,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,49,51,49,50,32,51,56,52,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,49,51,49,50,32,52,49,54,13,10,49,32,51,50,32,
-  54,52,32,51,50,32,51,50,32,49,51,49,50,32,52,52,56,13,10,49,32,57,54,32,48,
-  32,51,50,32,51,50,32,49,51,52,52,32,50,50,52,13,10,49,32,48,32,51,50,32,51,
-  50,32,51,50,32,49,51,52,52,32,50,53,54,13,10,49,32,48,32,51,50,32,51,50,32,
-  51,50,32,49,51,52,52,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,49,51,52,52,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,49,51,52,52,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  49,51,52,52,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,
-  51,52,52,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,49,51,
-  52,52,32,52,52,56,13,10,49,32,54,52,32,48,32,51,50,32,51,50,32,49,51,55,54,
-  32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,51,55,54,32,
-  50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,51,55,54,32,51,
-  50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,51,55,54,32,51,53,
-  50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,51,55,54,32,51,56,52,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,51,55,54,32,52,49,54,13,
-  10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,49,51,55,54,32,52,52,56,13,10,
-  49,32,51,50,32,48,32,51,50,32,51,50,32,49,52,48,56,32,50,56,56,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,49,52,48,56,32,51,50,48,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,49,52,48,56,32,51,53,50,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,49,52,48,56,32,51,56,52,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,49,52,48,56,32,52,49,54,13,10,49,32,51,50,32,54,
-  52,32,51,50,32,51,50,32,49,52,48,56,32,52,52,56,13,10,49,32,51,50,32,48,32,
-  51,50,32,51,50,32,49,52,52,48,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,49,52,52,48,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,49,52,52,48,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,49,52,52,48,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,49,52,52,48,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,
-  32,49,52,52,48,32,52,52,56,13,10,49,32,57,54,32,48,32,51,50,32,51,50,32,49,
-  52,55,50,32,49,57,50,13,10,49,32,57,54,32,51,50,32,51,50,32,51,50,32,49,52,
-  55,50,32,50,50,52,13,10,49,32,48,32,51,50,32,51,50,32,51,50,32,49,52,55,50,
-  32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,52,55,50,32,
-  50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,52,55,50,32,51,
-  50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,52,55,50,32,51,53,
-  50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,52,55,50,32,51,56,52,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,52,55,50,32,52,49,54,13,
-  10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,49,52,55,50,32,52,52,56,13,10,
-  49,32,51,50,32,48,32,51,50,32,51,50,32,49,53,48,52,32,50,53,54,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,49,53,48,52,32,50,56,56,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,49,53,48,52,32,51,50,48,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,49,53,48,52,32,51,53,50,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,49,53,48,52,32,51,56,52,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,49,53,48,52,32,52,49,54,13,10,49,32,51,50,32,54,52,
-  32,51,50,32,51,50,32,49,53,48,52,32,52,52,56,13,10,49,32,51,50,32,48,32,51,
-  50,32,51,50,32,49,53,51,54,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,49,53,51,54,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,49,53,51,54,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,49,53,51,54,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,49,53,51,54,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  49,53,51,54,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,49,
-  53,51,54,32,52,52,56,13,10,49,32,54,52,32,48,32,51,50,32,51,50,32,49,53,54,
-  56,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,53,54,56,
-  32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,53,54,56,32,
-  51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,53,54,56,32,51,
-  53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,53,54,56,32,51,56,
-  52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,53,54,56,32,52,49,54,
-  13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,49,53,54,56,32,52,52,56,13,
-  10,49,32,51,50,32,48,32,51,50,32,51,50,32,49,54,48,48,32,50,56,56,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,49,54,48,48,32,51,50,48,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,49,54,48,48,32,51,53,50,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,49,54,48,48,32,51,56,52,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,49,54,48,48,32,52,49,54,13,10,49,32,51,50,32,
-  54,52,32,51,50,32,51,50,32,49,54,48,48,32,52,52,56,13,10,49,32,51,50,32,48,
-  32,51,50,32,51,50,32,49,54,51,50,32,50,56,56,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,49,54,51,50,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,49,54,51,50,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,49,54,51,50,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,49,54,51,50,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,
-  50,32,49,54,51,50,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,
-  49,54,54,52,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,
-  54,54,52,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,54,
-  54,52,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,54,54,
-  52,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,54,54,52,
-  32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,49,54,54,52,32,
-  52,52,56,13,10,49,32,48,32,48,32,51,50,32,51,50,32,49,54,57,54,32,50,53,54,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,54,57,54,32,50,56,56,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,54,57,54,32,51,50,48,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,54,57,54,32,51,53,50,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,49,54,57,54,32,51,56,52,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,49,54,57,54,32,52,49,54,13,10,49,32,51,
-  50,32,54,52,32,51,50,32,51,50,32,49,54,57,54,32,52,52,56,13,10,49,32,57,54,
-  32,48,32,51,50,32,51,50,32,49,55,50,56,32,49,50,56,13,10,49,32,57,54,32,51,
-  50,32,51,50,32,51,50,32,49,55,50,56,32,49,54,48,13,10,49,32,57,54,32,51,50,
-  32,51,50,32,51,50,32,49,55,50,56,32,49,57,50,13,10,49,32,57,54,32,51,50,32,
-  51,50,32,51,50,32,49,55,50,56,32,50,50,52,13,10,49,32,54,52,32,51,50,32,51,
-  50,32,51,50,32,49,55,50,56,32,50,53,54,13,10,49,32,54,52,32,51,50,32,51,50,
-  32,51,50,32,49,55,50,56,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,49,55,50,56,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,49,55,50,56,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,49,55,50,56,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  49,55,50,56,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,49,
-  55,50,56,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,49,55,54,
-  48,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,55,54,48,
-  32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,55,54,48,32,
-  51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,55,54,48,32,52,
-  49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,49,55,54,48,32,52,52,
-  56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,49,55,57,50,32,51,50,48,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,55,57,50,32,51,53,50,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,55,57,50,32,51,56,52,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,49,55,57,50,32,52,49,54,13,10,49,32,
-  51,50,32,54,52,32,51,50,32,51,50,32,49,55,57,50,32,52,52,56,13,10,49,32,51,
-  50,32,48,32,51,50,32,51,50,32,49,56,50,52,32,51,50,48,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,49,56,50,52,32,51,53,50,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,49,56,50,52,32,51,56,52,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,49,56,50,52,32,52,49,54,13,10,49,32,51,50,32,54,52,32,
-  51,50,32,51,50,32,49,56,50,52,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,
-  32,51,50,32,49,56,53,54,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,49,56,53,54,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,49,56,53,54,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,49,56,53,54,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,
-  49,56,53,54,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,49,56,
-  56,56,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,56,56,
-  56,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,56,56,56,
-  32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,56,56,56,32,
-  52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,49,56,56,56,32,52,
-  52,56,13,10,49,32,48,32,48,32,51,50,32,51,50,32,49,57,50,48,32,50,56,56,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,57,50,48,32,51,50,48,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,57,50,48,32,51,53,50,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,49,57,50,48,32,51,56,52,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,49,57,50,48,32,52,49,54,13,10,49,32,51,
-  50,32,54,52,32,51,50,32,51,50,32,49,57,50,48,32,52,52,56,13,10,49,32,51,50,
-  32,48,32,51,50,32,51,50,32,49,57,53,50,32,50,56,56,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,49,57,53,50,32,51,50,48,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,49,57,53,50,32,51,53,50,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,49,57,53,50,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,49,57,53,50,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,
-  32,51,50,32,49,57,53,50,32,52,52,56,13,10,49,32,48,32,48,32,51,50,32,51,50,
-  32,49,57,56,52,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  49,57,56,52,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,
-  57,56,52,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,57,
-  56,52,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,57,56,
-  52,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,49,57,56,52,
-  32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,49,57,56,52,32,
-  52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,50,48,49,54,32,50,53,
-  54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,48,49,54,32,50,56,56,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,48,49,54,32,51,50,48,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,48,49,54,32,51,53,50,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,48,49,54,32,51,56,52,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,50,48,49,54,32,52,49,54,13,10,49,32,
-  51,50,32,54,52,32,51,50,32,51,50,32,50,48,49,54,32,52,52,56,13,10,49,32,54,
-  52,32,48,32,51,50,32,51,50,32,50,48,52,56,32,50,53,54,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,50,48,52,56,32,50,56,56,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,50,48,52,56,32,51,50,48,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,50,48,52,56,32,51,53,50,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,50,48,52,56,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,50,48,52,56,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,
-  32,51,50,32,50,48,52,56,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,
-  50,32,50,48,56,48,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,50,48,56,48,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  50,48,56,48,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,
-  48,56,48,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,48,
-  56,48,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,50,48,56,
-  48,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,50,49,49,50,32,
-  50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,49,49,50,32,51,
-  50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,49,49,50,32,51,53,
-  50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,49,49,50,32,51,56,52,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,49,49,50,32,52,49,54,13,
-  10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,50,49,49,50,32,52,52,56,13,10,
-  49,32,51,50,32,48,32,51,50,32,51,50,32,50,49,52,52,32,50,56,56,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,50,49,52,52,32,51,50,48,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,50,49,52,52,32,51,53,50,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,50,49,52,52,32,51,56,52,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,50,49,52,52,32,52,49,54,13,10,49,32,51,50,32,54,
-  52,32,51,50,32,51,50,32,50,49,52,52,32,52,52,56,13,10,49,32,57,54,32,48,32,
-  51,50,32,51,50,32,50,49,55,54,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,50,49,55,54,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,50,49,55,54,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,50,49,55,54,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,50,49,55,54,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,50,49,55,54,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,
-  50,49,55,54,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,50,50,
-  48,56,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,50,48,
-  56,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,50,48,56,
-  32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,50,48,56,32,
-  51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,50,48,56,32,52,
-  49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,50,50,48,56,32,52,52,
-  56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,50,50,52,48,32,50,56,56,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,50,52,48,32,51,50,48,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,50,52,48,32,51,53,50,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,50,50,52,48,32,51,56,52,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,50,50,52,48,32,52,49,54,13,10,49,32,51,
-  50,32,54,52,32,51,50,32,51,50,32,50,50,52,48,32,52,52,56,13,10,49,32,51,50,
-  32,48,32,51,50,32,51,50,32,50,50,55,50,32,50,56,56,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,50,50,55,50,32,51,50,48,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,50,50,55,50,32,51,53,50,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,50,50,55,50,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,50,50,55,50,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,
-  32,51,50,32,50,50,55,50,32,52,52,56,13,10,49,32,54,52,32,48,32,51,50,32,51,
-  50,32,50,51,48,52,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,50,51,48,52,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  50,51,48,52,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,
-  51,48,52,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,51,
-  48,52,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,50,51,48,
-  52,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,50,51,51,54,32,
-  51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,51,51,54,32,51,
-  53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,51,51,54,32,51,56,
-  52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,51,51,54,32,52,49,54,
-  13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,50,51,51,54,32,52,52,56,13,
-  10,49,32,48,32,57,54,32,51,50,32,51,50,32,50,51,54,56,32,49,57,50,13,10,49,
-  32,51,50,32,48,32,51,50,32,51,50,32,50,51,54,56,32,51,50,48,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,50,51,54,56,32,51,53,50,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,50,51,54,56,32,51,56,52,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,50,51,54,56,32,52,49,54,13,10,49,32,51,50,32,54,
-  52,32,51,50,32,51,50,32,50,51,54,56,32,52,52,56,13,10,49,32,51,50,32,57,54,
-  32,51,50,32,51,50,32,50,52,48,48,32,49,57,50,13,10,49,32,51,50,32,48,32,51,
-  50,32,51,50,32,50,52,48,48,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,50,52,48,48,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,50,52,48,48,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,50,52,48,48,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,
-  32,50,52,48,48,32,52,52,56,13,10,49,32,51,50,32,57,54,32,51,50,32,51,50,32,
-  50,52,51,50,32,49,57,50,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,50,52,
-  51,50,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,52,51,
-  50,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,52,51,50,
-  32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,52,51,50,32,
-  52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,50,52,51,50,32,52,
-  52,56,13,10,49,32,51,50,32,57,54,32,51,50,32,51,50,32,50,52,54,52,32,49,57,
-  50,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,50,52,54,52,32,51,50,48,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,52,54,52,32,51,53,50,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,52,54,52,32,51,56,52,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,50,52,54,52,32,52,49,54,13,10,49,32,
-  51,50,32,54,52,32,51,50,32,51,50,32,50,52,54,52,32,52,52,56,13,10,49,32,54,
-  52,32,57,54,32,51,50,32,51,50,32,50,52,57,54,32,49,57,50,13,10,49,32,51,50,
-  32,48,32,51,50,32,51,50,32,50,52,57,54,32,51,50,48,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,50,52,57,54,32,51,53,50,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,50,52,57,54,32,51,56,52,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,50,52,57,54,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,
-  50,32,51,50,32,50,52,57,54,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,
-  51,50,32,50,53,50,56,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,50,53,50,56,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,50,53,50,56,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  50,53,50,56,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,50,
-  53,50,56,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,50,53,54,
-  48,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,53,54,48,
-  32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,53,54,48,32,
-  51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,53,54,48,32,52,
-  49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,50,53,54,48,32,52,52,
-  56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,50,53,57,50,32,51,50,48,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,53,57,50,32,51,53,50,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,53,57,50,32,51,56,52,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,50,53,57,50,32,52,49,54,13,10,49,32,
-  51,50,32,54,52,32,51,50,32,51,50,32,50,53,57,50,32,52,52,56,13,10,49,32,51,
-  50,32,48,32,51,50,32,51,50,32,50,54,50,52,32,51,50,48,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,50,54,50,52,32,51,53,50,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,50,54,50,52,32,51,56,52,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,50,54,50,52,32,52,49,54,13,10,49,32,51,50,32,54,52,32,
-  51,50,32,51,50,32,50,54,50,52,32,52,52,56,13,10,49,32,48,32,48,32,51,50,32,
-  51,50,32,50,54,53,54,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,50,54,53,54,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,50,54,53,54,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  50,54,53,54,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,
-  54,53,54,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,50,54,
-  53,54,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,50,54,56,56,
-  32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,54,56,56,32,
-  51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,54,56,56,32,51,
-  53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,54,56,56,32,51,56,
-  52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,54,56,56,32,52,49,54,
-  13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,50,54,56,56,32,52,52,56,13,
-  10,49,32,51,50,32,48,32,51,50,32,51,50,32,50,55,50,48,32,50,56,56,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,50,55,50,48,32,51,50,48,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,50,55,50,48,32,51,53,50,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,50,55,50,48,32,51,56,52,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,50,55,50,48,32,52,49,54,13,10,49,32,51,50,32,
-  54,52,32,51,50,32,51,50,32,50,55,50,48,32,52,52,56,13,10,49,32,51,50,32,48,
-  32,51,50,32,51,50,32,50,55,53,50,32,50,56,56,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,50,55,53,50,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,50,55,53,50,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,50,55,53,50,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,50,55,53,50,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,
-  50,32,50,55,53,50,32,52,52,56,13,10,49,32,48,32,48,32,51,50,32,51,50,32,50,
-  55,56,52,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,55,
-  56,52,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,55,56,
-  52,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,55,56,52,
-  32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,55,56,52,32,
-  51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,55,56,52,32,52,
-  49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,50,55,56,52,32,52,52,
-  56,13,10,49,32,54,52,32,48,32,51,50,32,51,50,32,50,56,49,54,32,50,53,54,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,56,49,54,32,50,56,56,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,56,49,54,32,51,50,48,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,50,56,49,54,32,51,53,50,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,50,56,49,54,32,51,56,52,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,50,56,49,54,32,52,49,54,13,10,49,32,51,50,
-  32,54,52,32,51,50,32,51,50,32,50,56,49,54,32,52,52,56,13,10,49,32,51,50,32,
-  48,32,51,50,32,51,50,32,50,56,52,56,32,50,56,56,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,50,56,52,56,32,51,50,48,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,50,56,52,56,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,50,56,52,56,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,50,56,52,56,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,
-  51,50,32,50,56,52,56,32,52,52,56,13,10,49,32,54,52,32,48,32,51,50,32,51,50,
-  32,50,56,56,48,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  50,56,56,48,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,
-  56,56,48,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,56,
-  56,48,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,56,56,
-  48,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,50,56,56,48,
-  32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,50,57,49,50,32,51,
-  50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,57,49,50,32,51,53,
-  50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,57,49,50,32,51,56,52,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,50,57,49,50,32,52,49,54,13,
-  10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,50,57,49,50,32,52,52,56,13,10,
-  49,32,51,50,32,48,32,51,50,32,51,50,32,50,57,52,52,32,51,50,48,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,50,57,52,52,32,51,53,50,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,50,57,52,52,32,51,56,52,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,50,57,52,52,32,52,49,54,13,10,49,32,51,50,32,
-  54,52,32,51,50,32,51,50,32,50,57,52,52,32,52,52,56,13,10,49,32,48,32,48,32,
-  51,50,32,51,50,32,50,57,55,54,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,50,57,55,54,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,50,57,55,54,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,50,57,55,54,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,50,57,55,54,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,
-  32,50,57,55,54,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,51,
-  48,48,56,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,48,
-  48,56,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,48,48,
-  56,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,48,48,56,
-  32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,48,48,56,32,
-  52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,51,48,48,56,32,52,
-  52,56,13,10,49,32,48,32,48,32,51,50,32,51,50,32,51,48,52,48,32,50,53,54,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,48,52,48,32,50,56,56,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,48,52,48,32,51,50,48,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,51,48,52,48,32,51,53,50,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,51,48,52,48,32,51,56,52,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,51,48,52,48,32,52,49,54,13,10,49,32,51,50,
-  32,54,52,32,51,50,32,51,50,32,51,48,52,48,32,52,52,56,13,10,49,32,51,50,32,
-  48,32,51,50,32,51,50,32,51,48,55,50,32,50,53,54,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,51,48,55,50,32,50,56,56,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,51,48,55,50,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,51,48,55,50,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,51,48,55,50,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,51,48,55,50,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,
-  50,32,51,48,55,50,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,
-  51,49,48,52,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,
-  49,48,52,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,49,
-  48,52,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,49,48,
-  52,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,49,48,52,
-  32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,49,48,52,32,
-  52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,51,49,48,52,32,52,
-  52,56,13,10,49,32,54,52,32,48,32,51,50,32,51,50,32,51,49,51,54,32,50,53,54,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,49,51,54,32,50,56,56,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,49,51,54,32,51,50,48,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,49,51,54,32,51,53,50,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,51,49,51,54,32,51,56,52,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,51,49,51,54,32,52,49,54,13,10,49,32,51,
-  50,32,54,52,32,51,50,32,51,50,32,51,49,51,54,32,52,52,56,13,10,49,32,54,52,
-  32,48,32,51,50,32,51,50,32,51,49,54,56,32,50,56,56,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,51,49,54,56,32,51,50,48,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,51,49,54,56,32,51,53,50,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,51,49,54,56,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,51,49,54,56,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,
-  32,51,50,32,51,49,54,56,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,
-  50,32,51,50,48,48,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,51,50,48,48,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  51,50,48,48,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,
-  50,48,48,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,51,50,
-  48,48,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,51,50,51,50,
-  32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,50,51,50,32,
-  51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,50,51,50,32,51,
-  56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,50,51,50,32,52,49,
-  54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,51,50,51,50,32,52,52,56,
-  13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,51,50,54,52,32,51,50,48,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,50,54,52,32,51,53,50,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,51,50,54,52,32,51,56,52,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,51,50,54,52,32,52,49,54,13,10,49,32,51,
-  50,32,54,52,32,51,50,32,51,50,32,51,50,54,52,32,52,52,56,13,10,49,32,51,50,
-  32,48,32,51,50,32,51,50,32,51,50,57,54,32,51,50,48,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,51,50,57,54,32,51,53,50,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,51,50,57,54,32,51,56,52,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,51,50,57,54,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,
-  50,32,51,50,32,51,50,57,54,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,
-  51,50,32,51,51,50,56,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,51,51,50,56,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,51,51,50,56,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  51,51,50,56,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,51,
-  51,50,56,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,51,51,54,
-  48,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,51,54,48,
-  32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,51,54,48,32,
-  51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,51,54,48,32,52,
-  49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,51,51,54,48,32,52,52,
-  56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,51,51,57,50,32,51,50,48,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,51,57,50,32,51,53,50,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,51,57,50,32,51,56,52,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,51,51,57,50,32,52,49,54,13,10,49,32,
-  51,50,32,54,52,32,51,50,32,51,50,32,51,51,57,50,32,52,52,56,13,10,49,32,48,
-  32,48,32,51,50,32,51,50,32,51,52,50,52,32,50,56,56,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,51,52,50,52,32,51,50,48,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,51,52,50,52,32,51,53,50,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,51,52,50,52,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,51,52,50,52,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,
-  32,51,50,32,51,52,50,52,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,
-  50,32,51,52,53,54,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,51,52,53,54,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  51,52,53,54,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,
-  52,53,54,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,52,
-  53,54,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,51,52,53,
-  54,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,51,52,56,56,32,
-  50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,52,56,56,32,51,
-  50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,52,56,56,32,51,53,
-  50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,52,56,56,32,51,56,52,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,52,56,56,32,52,49,54,13,
-  10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,51,52,56,56,32,52,52,56,13,10,
-  49,32,48,32,48,32,51,50,32,51,50,32,51,53,50,48,32,50,53,54,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,51,53,50,48,32,50,56,56,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,51,53,50,48,32,51,50,48,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,51,53,50,48,32,51,53,50,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,51,53,50,48,32,51,56,52,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,51,53,50,48,32,52,49,54,13,10,49,32,51,50,32,54,52,32,
-  51,50,32,51,50,32,51,53,50,48,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,
-  32,51,50,32,51,53,53,50,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,51,53,53,50,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,51,53,53,50,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,51,53,53,50,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  51,53,53,50,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,
-  53,53,50,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,51,53,
-  53,50,32,52,52,56,13,10,49,32,48,32,48,32,51,50,32,51,50,32,51,53,56,52,32,
-  50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,53,56,52,32,50,
-  53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,53,56,52,32,50,56,
-  56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,53,56,52,32,51,50,48,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,53,56,52,32,51,53,50,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,53,56,52,32,51,56,52,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,53,56,52,32,52,49,54,13,10,49,
-  32,51,50,32,54,52,32,51,50,32,51,50,32,51,53,56,52,32,52,52,56,13,10,49,32,
-  51,50,32,48,32,51,50,32,51,50,32,51,54,49,54,32,50,50,52,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,51,54,49,54,32,50,53,54,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,51,54,49,54,32,50,56,56,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,51,54,49,54,32,51,50,48,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,51,54,49,54,32,51,53,50,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,51,54,49,54,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,51,54,49,54,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,
-  32,51,50,32,51,54,49,54,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,
-  50,32,51,54,52,56,32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,51,54,52,56,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  51,54,52,56,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,
-  54,52,56,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,54,
-  52,56,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,54,52,
-  56,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,54,52,56,
-  32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,51,54,52,56,32,
-  52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,51,54,56,48,32,50,50,
-  52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,54,56,48,32,50,53,54,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,54,56,48,32,50,56,56,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,54,56,48,32,51,50,48,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,54,56,48,32,51,53,50,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,51,54,56,48,32,51,56,52,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,51,54,56,48,32,52,49,54,13,10,49,32,51,
-  50,32,54,52,32,51,50,32,51,50,32,51,54,56,48,32,52,52,56,13,10,49,32,48,32,
-  48,32,51,50,32,51,50,32,51,55,49,50,32,49,57,50,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,51,55,49,50,32,50,50,52,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,51,55,49,50,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,51,55,49,50,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,51,55,49,50,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,51,55,49,50,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,51,55,49,50,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,51,55,49,50,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,
-  51,55,49,50,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,51,55,
-  52,52,32,49,57,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,55,52,
-  52,32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,55,52,52,
-  32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,55,52,52,32,
-  50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,55,52,52,32,51,
-  50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,55,52,52,32,51,53,
-  50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,55,52,52,32,51,56,52,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,55,52,52,32,52,49,54,13,
-  10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,51,55,52,52,32,52,52,56,13,10,
-  49,32,51,50,32,48,32,51,50,32,51,50,32,51,55,55,54,32,49,57,50,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,51,55,55,54,32,50,50,52,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,51,55,55,54,32,50,53,54,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,51,55,55,54,32,50,56,56,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,51,55,55,54,32,51,50,48,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,51,55,55,54,32,51,53,50,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,51,55,55,54,32,51,56,52,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,51,55,55,54,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,
-  50,32,51,50,32,51,55,55,54,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,
-  51,50,32,51,56,48,56,32,49,57,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,51,56,48,56,32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,51,56,48,56,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  51,56,48,56,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,
-  56,48,56,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,56,
-  48,56,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,56,48,
-  56,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,56,48,56,
-  32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,51,56,48,56,32,
-  52,52,56,13,10,49,32,54,52,32,48,32,51,50,32,51,50,32,51,56,52,48,32,49,57,
-  50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,56,52,48,32,50,50,52,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,56,52,48,32,50,53,54,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,56,52,48,32,50,56,56,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,56,52,48,32,51,50,48,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,51,56,52,48,32,51,53,50,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,51,56,52,48,32,51,56,52,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,51,56,52,48,32,52,49,54,13,10,49,32,51,50,
-  32,54,52,32,51,50,32,51,50,32,51,56,52,48,32,52,52,56,13,10,49,32,51,50,32,
-  48,32,51,50,32,51,50,32,51,56,55,50,32,50,50,52,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,51,56,55,50,32,50,53,54,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,51,56,55,50,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,51,56,55,50,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,51,56,55,50,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,51,56,55,50,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,51,56,55,50,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,
-  32,51,56,55,50,32,52,52,56,13,10,49,32,54,52,32,48,32,51,50,32,51,50,32,51,
-  57,48,52,32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,57,
-  48,52,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,57,48,
-  52,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,57,48,52,
-  32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,57,48,52,32,
-  51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,57,48,52,32,51,
-  56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,57,48,52,32,52,49,
-  54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,51,57,48,52,32,52,52,56,
-  13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,51,57,51,54,32,50,53,54,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,51,57,51,54,32,50,56,56,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,51,57,51,54,32,51,50,48,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,51,57,51,54,32,51,53,50,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,51,57,51,54,32,51,56,52,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,51,57,51,54,32,52,49,54,13,10,49,32,51,50,32,
-  54,52,32,51,50,32,51,50,32,51,57,51,54,32,52,52,56,13,10,49,32,51,50,32,48,
-  32,51,50,32,51,50,32,51,57,54,56,32,50,53,54,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,51,57,54,56,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,51,57,54,56,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,51,57,54,56,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,51,57,54,56,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,51,57,54,56,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,
-  32,51,57,54,56,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,52,
-  48,48,48,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,48,
-  48,48,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,48,48,
-  48,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,48,48,48,
-  32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,48,48,48,32,
-  51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,48,48,48,32,52,
-  49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,52,48,48,48,32,52,52,
-  56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,52,48,51,50,32,50,53,54,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,48,51,50,32,50,56,56,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,48,51,50,32,51,50,48,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,52,48,51,50,32,51,53,50,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,52,48,51,50,32,51,56,52,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,52,48,51,50,32,52,49,54,13,10,49,32,51,50,
-  32,54,52,32,51,50,32,51,50,32,52,48,51,50,32,52,52,56,13,10,49,32,51,50,32,
-  48,32,51,50,32,51,50,32,52,48,54,52,32,50,53,54,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,52,48,54,52,32,50,56,56,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,52,48,54,52,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,52,48,54,52,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,52,48,54,52,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,52,48,54,52,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,
-  50,32,52,48,54,52,32,52,52,56,13,10,49,32,54,52,32,48,32,51,50,32,51,50,32,
-  52,48,57,54,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,
-  48,57,54,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,48,
-  57,54,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,48,57,
-  54,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,48,57,54,
-  32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,48,57,54,32,
-  52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,52,48,57,54,32,52,
-  52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,52,49,50,56,32,50,56,56,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,49,50,56,32,51,50,48,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,49,50,56,32,51,53,50,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,49,50,56,32,51,56,52,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,52,49,50,56,32,52,49,54,13,10,49,32,
-  51,50,32,54,52,32,51,50,32,51,50,32,52,49,50,56,32,52,52,56,13,10,49,32,51,
-  50,32,48,32,51,50,32,51,50,32,52,49,54,48,32,50,56,56,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,52,49,54,48,32,51,50,48,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,52,49,54,48,32,51,53,50,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,52,49,54,48,32,51,56,52,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,52,49,54,48,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,
-  50,32,51,50,32,52,49,54,48,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,
-  51,50,32,52,49,57,50,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,52,49,57,50,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,52,49,57,50,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  52,49,57,50,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,
-  49,57,50,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,52,49,
-  57,50,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,52,50,50,52,
-  32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,50,50,52,32,
-  51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,50,50,52,32,51,
-  53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,50,50,52,32,51,56,
-  52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,50,50,52,32,52,49,54,
-  13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,52,50,50,52,32,52,52,56,13,
-  10,49,32,51,50,32,48,32,51,50,32,51,50,32,52,50,53,54,32,50,56,56,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,52,50,53,54,32,51,50,48,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,52,50,53,54,32,51,53,50,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,52,50,53,54,32,51,56,52,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,52,50,53,54,32,52,49,54,13,10,49,32,51,50,32,
-  54,52,32,51,50,32,51,50,32,52,50,53,54,32,52,52,56,13,10,49,32,51,50,32,48,
-  32,51,50,32,51,50,32,52,50,56,56,32,50,56,56,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,52,50,56,56,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,52,50,56,56,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,52,50,56,56,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,52,50,56,56,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,
-  50,32,52,50,56,56,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,
-  52,51,50,48,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,
-  51,50,48,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,51,
-  50,48,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,51,50,
-  48,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,51,50,48,
-  32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,52,51,50,48,32,
-  52,52,56,13,10,49,32,48,32,57,54,32,51,50,32,51,50,32,52,51,53,50,32,49,54,
-  48,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,52,51,53,50,32,50,56,56,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,51,53,50,32,51,50,48,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,51,53,50,32,51,53,50,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,52,51,53,50,32,51,56,52,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,52,51,53,50,32,52,49,54,13,10,49,32,51,
-  50,32,54,52,32,51,50,32,51,50,32,52,51,53,50,32,52,52,56,13,10,49,32,51,50,
-  32,57,54,32,51,50,32,51,50,32,52,51,56,52,32,49,54,48,13,10,49,32,51,50,32,
-  48,32,51,50,32,51,50,32,52,51,56,52,32,50,56,56,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,52,51,56,52,32,51,50,48,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,52,51,56,52,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,52,51,56,52,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,52,51,56,52,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,
-  51,50,32,52,51,56,52,32,52,52,56,13,10,49,32,51,50,32,57,54,32,51,50,32,51,
-  50,32,52,52,49,54,32,49,54,48,13,10,49,32,54,52,32,48,32,51,50,32,51,50,32,
-  52,52,49,54,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,
-  52,49,54,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,52,
-  49,54,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,52,49,
-  54,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,52,49,54,
-  32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,52,52,49,54,32,
-  52,52,56,13,10,49,32,54,52,32,57,54,32,51,50,32,51,50,32,52,52,52,56,32,49,
-  54,48,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,52,52,52,56,32,51,50,48,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,52,52,56,32,51,53,50,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,52,52,56,32,51,56,52,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,52,52,56,32,52,49,54,13,10,49,
-  32,51,50,32,54,52,32,51,50,32,51,50,32,52,52,52,56,32,52,52,56,13,10,49,32,
-  51,50,32,48,32,51,50,32,51,50,32,52,52,56,48,32,51,50,48,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,52,52,56,48,32,51,53,50,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,52,52,56,48,32,51,56,52,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,52,52,56,48,32,52,49,54,13,10,49,32,51,50,32,54,52,
-  32,51,50,32,51,50,32,52,52,56,48,32,52,52,56,13,10,49,32,51,50,32,48,32,51,
-  50,32,51,50,32,52,53,49,50,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,52,53,49,50,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,52,53,49,50,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,52,53,49,50,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,
-  32,52,53,49,50,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,52,
-  53,52,52,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,53,
-  52,52,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,53,52,
-  52,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,53,52,52,
-  32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,52,53,52,52,32,
-  52,52,56,13,10,49,32,48,32,48,32,51,50,32,51,50,32,52,53,55,54,32,50,53,54,
-  13,10,49,32,48,32,51,50,32,51,50,32,51,50,32,52,53,55,54,32,50,56,56,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,53,55,54,32,51,50,48,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,52,53,55,54,32,51,53,50,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,52,53,55,54,32,51,56,52,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,52,53,55,54,32,52,49,54,13,10,49,32,51,50,
-  32,54,52,32,51,50,32,51,50,32,52,53,55,54,32,52,52,56,13,10,49,32,48,32,48,
-  32,51,50,32,51,50,32,52,54,48,56,32,49,57,50,13,10,49,32,48,32,51,50,32,51,
-  50,32,51,50,32,52,54,48,56,32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,52,54,48,56,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,52,54,48,56,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,52,54,48,56,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,52,54,48,56,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  52,54,48,56,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,
-  54,48,56,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,52,54,
-  48,56,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,52,54,52,48,
-  32,49,57,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,54,52,48,32,
-  50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,54,52,48,32,50,
-  53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,54,52,48,32,50,56,
-  56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,54,52,48,32,51,50,48,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,54,52,48,32,51,53,50,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,54,52,48,32,51,56,52,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,54,52,48,32,52,49,54,13,10,49,
-  32,51,50,32,54,52,32,51,50,32,51,50,32,52,54,52,48,32,52,52,56,13,10,49,32,
-  54,52,32,48,32,51,50,32,51,50,32,52,54,55,50,32,49,57,50,13,10,49,32,54,52,
-  32,51,50,32,51,50,32,51,50,32,52,54,55,50,32,50,50,52,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,52,54,55,50,32,50,53,54,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,52,54,55,50,32,50,56,56,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,52,54,55,50,32,51,50,48,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,52,54,55,50,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,52,54,55,50,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,52,54,55,50,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,
-  51,50,32,52,54,55,50,32,52,52,56,13,10,49,32,54,52,32,48,32,51,50,32,51,50,
-  32,52,55,48,52,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  52,55,48,52,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,
-  55,48,52,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,55,
-  48,52,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,55,48,
-  52,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,55,48,52,
-  32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,52,55,48,52,32,
-  52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,52,55,51,54,32,50,56,
-  56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,55,51,54,32,51,50,48,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,55,51,54,32,51,53,50,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,55,51,54,32,51,56,52,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,55,51,54,32,52,49,54,13,10,49,
-  32,51,50,32,54,52,32,51,50,32,51,50,32,52,55,51,54,32,52,52,56,13,10,49,32,
-  51,50,32,48,32,51,50,32,51,50,32,52,55,54,56,32,50,56,56,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,52,55,54,56,32,51,50,48,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,52,55,54,56,32,51,53,50,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,52,55,54,56,32,51,56,52,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,52,55,54,56,32,52,49,54,13,10,49,32,51,50,32,54,52,32,
-  51,50,32,51,50,32,52,55,54,56,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,
-  32,51,50,32,52,56,48,48,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,52,56,48,48,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,52,56,48,48,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,52,56,48,48,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  52,56,48,48,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,52,
-  56,48,48,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,52,56,51,
-  50,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,56,51,50,
-  32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,56,51,50,32,
-  51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,56,51,50,32,51,
-  56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,56,51,50,32,52,49,
-  54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,52,56,51,50,32,52,52,56,
-  13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,52,56,54,52,32,50,56,56,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,56,54,52,32,51,50,48,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,52,56,54,52,32,51,53,50,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,52,56,54,52,32,51,56,52,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,52,56,54,52,32,52,49,54,13,10,49,32,51,50,
-  32,54,52,32,51,50,32,51,50,32,52,56,54,52,32,52,52,56,13,10,49,32,48,32,48,
-  32,51,50,32,51,50,32,52,56,57,54,32,50,53,54,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,52,56,57,54,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,52,56,57,54,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,52,56,57,54,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,52,56,57,54,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,52,56,57,54,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,
-  32,52,56,57,54,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,52,
-  57,50,56,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,57,
-  50,56,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,57,50,
-  56,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,57,50,56,
-  32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,57,50,56,32,
-  51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,57,50,56,32,52,
-  49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,52,57,50,56,32,52,52,
-  56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,52,57,54,48,32,50,53,54,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,57,54,48,32,50,56,56,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,52,57,54,48,32,51,50,48,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,52,57,54,48,32,51,53,50,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,52,57,54,48,32,51,56,52,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,52,57,54,48,32,52,49,54,13,10,49,32,51,50,
-  32,54,52,32,51,50,32,51,50,32,52,57,54,48,32,52,52,56,13,10,49,32,51,50,32,
-  48,32,51,50,32,51,50,32,52,57,57,50,32,50,53,54,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,52,57,57,50,32,50,56,56,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,52,57,57,50,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,52,57,57,50,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,52,57,57,50,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,52,57,57,50,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,
-  50,32,52,57,57,50,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,
-  53,48,50,52,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,
-  48,50,52,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,48,
-  50,52,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,48,50,
-  52,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,48,50,52,
-  32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,48,50,52,32,
-  52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,53,48,50,52,32,52,
-  52,56,13,10,49,32,48,32,48,32,51,50,32,51,50,32,53,48,53,54,32,50,50,52,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,48,53,54,32,50,53,54,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,48,53,54,32,50,56,56,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,53,48,53,54,32,51,50,48,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,53,48,53,54,32,51,53,50,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,53,48,53,54,32,51,56,52,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,53,48,53,54,32,52,49,54,13,10,49,32,51,50,32,
-  54,52,32,51,50,32,51,50,32,53,48,53,54,32,52,52,56,13,10,49,32,51,50,32,48,
-  32,51,50,32,51,50,32,53,48,56,56,32,50,50,52,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,53,48,56,56,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,53,48,56,56,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,53,48,56,56,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,53,48,56,56,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,53,48,56,56,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,53,48,56,56,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,
-  53,48,56,56,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,53,49,
-  50,48,32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,49,50,
-  48,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,49,50,48,
-  32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,49,50,48,32,
-  51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,49,50,48,32,51,
-  53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,49,50,48,32,51,56,
-  52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,49,50,48,32,52,49,54,
-  13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,53,49,50,48,32,52,52,56,13,
-  10,49,32,54,52,32,48,32,51,50,32,51,50,32,53,49,53,50,32,50,50,52,13,10,49,
-  32,54,52,32,51,50,32,51,50,32,51,50,32,53,49,53,50,32,50,53,54,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,53,49,53,50,32,50,56,56,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,53,49,53,50,32,51,50,48,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,53,49,53,50,32,51,53,50,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,53,49,53,50,32,51,56,52,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,53,49,53,50,32,52,49,54,13,10,49,32,51,50,32,54,52,
-  32,51,50,32,51,50,32,53,49,53,50,32,52,52,56,13,10,49,32,51,50,32,48,32,51,
-  50,32,51,50,32,53,49,56,52,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,53,49,56,52,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,53,49,56,52,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,53,49,56,52,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,53,49,56,52,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,
-  53,49,56,52,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,53,50,
-  49,54,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,50,49,
-  54,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,50,49,54,
-  32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,50,49,54,32,
-  51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,50,49,54,32,52,
-  49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,53,50,49,54,32,52,52,
-  56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,53,50,52,56,32,50,56,56,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,50,52,56,32,51,50,48,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,50,52,56,32,51,53,50,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,53,50,52,56,32,51,56,52,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,53,50,52,56,32,52,49,54,13,10,49,32,51,
-  50,32,54,52,32,51,50,32,51,50,32,53,50,52,56,32,52,52,56,13,10,49,32,51,50,
-  32,48,32,51,50,32,51,50,32,53,50,56,48,32,50,56,56,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,53,50,56,48,32,51,50,48,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,53,50,56,48,32,51,53,50,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,53,50,56,48,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,53,50,56,48,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,
-  32,51,50,32,53,50,56,48,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,
-  50,32,53,51,49,50,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,53,51,49,50,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  53,51,49,50,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,
-  51,49,50,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,51,
-  49,50,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,53,51,49,
-  50,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,53,51,52,52,32,
-  50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,51,52,52,32,51,
-  50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,51,52,52,32,51,53,
-  50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,51,52,52,32,51,56,52,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,51,52,52,32,52,49,54,13,
-  10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,53,51,52,52,32,52,52,56,13,10,
-  49,32,51,50,32,48,32,51,50,32,51,50,32,53,51,55,54,32,50,56,56,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,53,51,55,54,32,51,50,48,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,53,51,55,54,32,51,53,50,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,53,51,55,54,32,51,56,52,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,53,51,55,54,32,52,49,54,13,10,49,32,51,50,32,54,
-  52,32,51,50,32,51,50,32,53,51,55,54,32,52,52,56,13,10,49,32,51,50,32,48,32,
-  51,50,32,51,50,32,53,52,48,56,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,53,52,48,56,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,53,52,48,56,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,53,52,48,56,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,53,52,48,56,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,
-  32,53,52,48,56,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,53,
-  52,52,48,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,52,
-  52,48,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,52,52,
-  48,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,52,52,48,
-  32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,52,52,48,32,
-  52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,53,52,52,48,32,52,
-  52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,53,52,55,50,32,50,56,56,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,52,55,50,32,51,50,48,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,52,55,50,32,51,53,50,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,52,55,50,32,51,56,52,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,53,52,55,50,32,52,49,54,13,10,49,32,
-  51,50,32,54,52,32,51,50,32,51,50,32,53,52,55,50,32,52,52,56,13,10,49,32,48,
-  32,48,32,51,50,32,51,50,32,53,53,48,52,32,50,53,54,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,53,53,48,52,32,50,56,56,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,53,53,48,52,32,51,50,48,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,53,53,48,52,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,53,53,48,52,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,53,53,48,52,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,
-  51,50,32,53,53,48,52,32,52,52,56,13,10,49,32,48,32,48,32,51,50,32,51,50,32,
-  53,53,51,54,32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,
-  53,51,54,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,53,
-  51,54,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,53,51,
-  54,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,53,51,54,
-  32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,53,51,54,32,
-  51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,53,51,54,32,52,
-  49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,53,53,51,54,32,52,52,
-  56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,53,53,54,56,32,50,50,52,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,53,54,56,32,50,53,54,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,53,54,56,32,50,56,56,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,53,53,54,56,32,51,50,48,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,53,53,54,56,32,51,53,50,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,53,53,54,56,32,51,56,52,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,53,53,54,56,32,52,49,54,13,10,49,32,51,50,32,
-  54,52,32,51,50,32,51,50,32,53,53,54,56,32,52,52,56,13,10,49,32,51,50,32,48,
-  32,51,50,32,51,50,32,53,54,48,48,32,50,50,52,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,53,54,48,48,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,53,54,48,48,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,53,54,48,48,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,53,54,48,48,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,53,54,48,48,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,53,54,48,48,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,
-  53,54,48,48,32,52,52,56,13,10,49,32,48,32,48,32,51,50,32,51,50,32,53,54,51,
-  50,32,49,57,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,54,51,50,
-  32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,54,51,50,32,
-  50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,54,51,50,32,50,
-  56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,54,51,50,32,51,50,
-  48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,54,51,50,32,51,53,50,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,54,51,50,32,51,56,52,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,54,51,50,32,52,49,54,13,10,
-  49,32,51,50,32,54,52,32,51,50,32,51,50,32,53,54,51,50,32,52,52,56,13,10,49,
-  32,51,50,32,48,32,51,50,32,51,50,32,53,54,54,52,32,49,57,50,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,53,54,54,52,32,50,50,52,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,53,54,54,52,32,50,53,54,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,53,54,54,52,32,50,56,56,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,53,54,54,52,32,51,50,48,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,53,54,54,52,32,51,53,50,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,53,54,54,52,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,53,54,54,52,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,
-  32,51,50,32,53,54,54,52,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,
-  50,32,53,54,57,54,32,49,57,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,53,54,57,54,32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  53,54,57,54,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,
-  54,57,54,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,54,
-  57,54,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,54,57,
-  54,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,54,57,54,
-  32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,54,57,54,32,
-  52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,53,54,57,54,32,52,
-  52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,53,55,50,56,32,49,57,50,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,55,50,56,32,50,50,52,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,55,50,56,32,50,53,54,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,55,50,56,32,50,56,56,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,53,55,50,56,32,51,50,48,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,53,55,50,56,32,51,53,50,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,53,55,50,56,32,51,56,52,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,53,55,50,56,32,52,49,54,13,10,49,32,51,50,32,
-  54,52,32,51,50,32,51,50,32,53,55,50,56,32,52,52,56,13,10,49,32,51,50,32,48,
-  32,51,50,32,51,50,32,53,55,54,48,32,49,57,50,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,53,55,54,48,32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,53,55,54,48,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,53,55,54,48,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,53,55,54,48,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,53,55,54,48,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,53,55,54,48,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  53,55,54,48,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,53,
-  55,54,48,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,53,55,57,
-  50,32,49,57,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,55,57,50,
-  32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,55,57,50,32,
-  50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,55,57,50,32,50,
-  56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,55,57,50,32,51,50,
-  48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,55,57,50,32,51,53,50,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,55,57,50,32,51,56,52,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,55,57,50,32,52,49,54,13,10,
-  49,32,51,50,32,54,52,32,51,50,32,51,50,32,53,55,57,50,32,52,52,56,13,10,49,
-  32,57,54,32,48,32,51,50,32,51,50,32,53,56,50,52,32,49,54,48,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,53,56,50,52,32,49,57,50,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,53,56,50,52,32,50,50,52,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,53,56,50,52,32,50,53,54,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,53,56,50,52,32,50,56,56,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,53,56,50,52,32,51,50,48,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,53,56,50,52,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,53,56,50,52,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,53,56,50,52,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,
-  51,50,32,53,56,50,52,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,
-  32,53,56,53,54,32,49,57,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  53,56,53,54,32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,
-  56,53,54,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,56,
-  53,54,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,56,53,
-  54,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,56,53,54,
-  32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,56,53,54,32,
-  51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,56,53,54,32,52,
-  49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,53,56,53,54,32,52,52,
-  56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,53,56,56,56,32,49,57,50,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,56,56,56,32,50,50,52,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,56,56,56,32,50,53,54,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,53,56,56,56,32,50,56,56,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,53,56,56,56,32,51,50,48,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,53,56,56,56,32,51,53,50,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,53,56,56,56,32,51,56,52,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,53,56,56,56,32,52,49,54,13,10,49,32,51,50,32,54,
-  52,32,51,50,32,51,50,32,53,56,56,56,32,52,52,56,13,10,49,32,48,32,48,32,51,
-  50,32,51,50,32,53,57,50,48,32,49,54,48,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,53,57,50,48,32,49,57,50,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,53,57,50,48,32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,53,57,50,48,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,53,57,50,48,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  53,57,50,48,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,
-  57,50,48,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,57,
-  50,48,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,57,50,
-  48,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,53,57,50,48,
-  32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,53,57,53,50,32,49,
-  54,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,57,53,50,32,49,57,
-  50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,57,53,50,32,50,50,52,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,57,53,50,32,50,53,54,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,57,53,50,32,50,56,56,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,57,53,50,32,51,50,48,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,53,57,53,50,32,51,53,50,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,53,57,53,50,32,51,56,52,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,53,57,53,50,32,52,49,54,13,10,49,32,51,50,
-  32,54,52,32,51,50,32,51,50,32,53,57,53,50,32,52,52,56,13,10,49,32,57,54,32,
-  48,32,51,50,32,51,50,32,53,57,56,52,32,49,50,56,13,10,49,32,54,52,32,51,50,
-  32,51,50,32,51,50,32,53,57,56,52,32,49,54,48,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,53,57,56,52,32,49,57,50,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,53,57,56,52,32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,53,57,56,52,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,53,57,56,52,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,53,57,56,52,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,53,57,56,52,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  53,57,56,52,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,53,
-  57,56,52,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,53,57,
-  56,52,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,54,48,49,54,
-  32,49,57,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,48,49,54,32,
-  50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,48,49,54,32,50,
-  53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,48,49,54,32,50,56,
-  56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,48,49,54,32,51,50,48,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,48,49,54,32,51,53,50,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,48,49,54,32,51,56,52,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,48,49,54,32,52,49,54,13,10,49,
-  32,51,50,32,54,52,32,51,50,32,51,50,32,54,48,49,54,32,52,52,56,13,10,49,32,
-  51,50,32,48,32,51,50,32,51,50,32,54,48,52,56,32,49,57,50,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,54,48,52,56,32,50,50,52,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,54,48,52,56,32,50,53,54,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,54,48,52,56,32,50,56,56,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,54,48,52,56,32,51,50,48,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,54,48,52,56,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,54,48,52,56,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,54,48,52,56,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,
-  51,50,32,54,48,52,56,32,52,52,56,13,10,49,32,54,52,32,48,32,51,50,32,51,50,
-  32,54,48,56,48,32,49,57,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  54,48,56,48,32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,
-  48,56,48,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,48,
-  56,48,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,48,56,
-  48,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,48,56,48,
-  32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,48,56,48,32,
-  51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,48,56,48,32,52,
-  49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,54,48,56,48,32,52,52,
-  56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,54,49,49,50,32,50,50,52,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,49,49,50,32,50,53,54,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,49,49,50,32,50,56,56,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,54,49,49,50,32,51,50,48,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,54,49,49,50,32,51,53,50,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,54,49,49,50,32,51,56,52,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,54,49,49,50,32,52,49,54,13,10,49,32,51,50,32,
-  54,52,32,51,50,32,51,50,32,54,49,49,50,32,52,52,56,13,10,49,32,51,50,32,48,
-  32,51,50,32,51,50,32,54,49,52,52,32,50,50,52,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,54,49,52,52,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,54,49,52,52,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,54,49,52,52,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,54,49,52,52,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,54,49,52,52,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,54,49,52,52,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,
-  54,49,52,52,32,52,52,56,13,10,49,32,54,52,32,48,32,51,50,32,51,50,32,54,49,
-  55,54,32,50,50,52,13,10,49,32,54,52,32,51,50,32,51,50,32,51,50,32,54,49,55,
-  54,32,50,53,54,13,10,49,32,54,52,32,51,50,32,51,50,32,51,50,32,54,49,55,54,
-  32,50,56,56,13,10,49,32,54,52,32,51,50,32,51,50,32,51,50,32,54,49,55,54,32,
-  51,50,48,13,10,49,32,54,52,32,51,50,32,51,50,32,51,50,32,54,49,55,54,32,51,
-  53,50,13,10,49,32,54,52,32,51,50,32,51,50,32,51,50,32,54,49,55,54,32,51,56,
-  52,13,10,49,32,54,52,32,51,50,32,51,50,32,51,50,32,54,49,55,54,32,52,49,54,
-  13,10,49,32,54,52,32,54,52,32,51,50,32,51,50,32,54,49,55,54,32,52,52,56,13,
-  10,49,32,48,32,48,32,51,50,32,51,50,32,54,51,54,56,32,48,13,10,49,32,48,32,
-  51,50,32,51,50,32,51,50,32,54,51,54,56,32,51,50,13,10,49,32,48,32,51,50,32,
-  51,50,32,51,50,32,54,51,54,56,32,54,52,13,10,49,32,48,32,51,50,32,51,50,32,
-  51,50,32,54,51,54,56,32,57,54,13,10,49,32,48,32,51,50,32,51,50,32,51,50,32,
-  54,51,54,56,32,49,50,56,13,10,49,32,48,32,51,50,32,51,50,32,51,50,32,54,51,
-  54,56,32,49,54,48,13,10,49,32,48,32,51,50,32,51,50,32,51,50,32,54,51,54,56,
-  32,49,57,50,13,10,49,32,48,32,51,50,32,51,50,32,51,50,32,54,51,54,56,32,50,
-  50,52,13,10,49,32,48,32,51,50,32,51,50,32,51,50,32,54,51,54,56,32,50,53,54,
-  13,10,49,32,48,32,51,50,32,51,50,32,51,50,32,54,51,54,56,32,50,56,56,13,10,
-  49,32,48,32,51,50,32,51,50,32,51,50,32,54,51,54,56,32,51,50,48,13,10,49,32,
-  48,32,51,50,32,51,50,32,51,50,32,54,51,54,56,32,51,53,50,13,10,49,32,48,32,
-  51,50,32,51,50,32,51,50,32,54,51,54,56,32,51,56,52,13,10,49,32,48,32,51,50,
-  32,51,50,32,51,50,32,54,51,54,56,32,52,49,54,13,10,49,32,48,32,54,52,32,51,
-  50,32,51,50,32,54,51,54,56,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,
-  51,50,32,54,52,48,48,32,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  54,52,48,48,32,51,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,
-  48,48,32,54,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,48,48,
-  32,57,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,48,48,32,49,
-  50,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,48,48,32,49,54,
-  48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,48,48,32,49,57,50,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,48,48,32,50,50,52,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,48,48,32,50,53,54,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,48,48,32,50,56,56,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,48,48,32,51,50,48,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,54,52,48,48,32,51,53,50,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,54,52,48,48,32,51,56,52,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,54,52,48,48,32,52,49,54,13,10,49,32,51,50,32,
-  54,52,32,51,50,32,51,50,32,54,52,48,48,32,52,52,56,13,10,49,32,51,50,32,48,
-  32,51,50,32,51,50,32,54,52,51,50,32,48,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,54,52,51,50,32,51,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,54,52,51,50,32,54,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  54,52,51,50,32,57,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,
-  51,50,32,49,50,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,51,
-  50,32,49,54,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,51,50,
-  32,49,57,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,51,50,32,
-  50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,51,50,32,50,
-  53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,51,50,32,50,56,
-  56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,51,50,32,51,50,48,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,51,50,32,51,53,50,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,51,50,32,51,56,52,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,51,50,32,52,49,54,13,10,49,
-  32,51,50,32,54,52,32,51,50,32,51,50,32,54,52,51,50,32,52,52,56,13,10,49,32,
-  51,50,32,48,32,51,50,32,51,50,32,54,52,54,52,32,48,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,54,52,54,52,32,51,50,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,54,52,54,52,32,54,52,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,54,52,54,52,32,57,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,54,52,54,52,32,49,50,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,54,52,54,52,32,49,54,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  54,52,54,52,32,49,57,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,
-  52,54,52,32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,
-  54,52,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,54,
-  52,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,54,52,
-  32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,54,52,32,
-  51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,54,52,32,51,
-  56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,54,52,32,52,49,
-  54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,54,52,54,52,32,52,52,56,
-  13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,54,52,57,54,32,48,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,54,52,57,54,32,51,50,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,54,52,57,54,32,54,52,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,54,52,57,54,32,57,54,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,54,52,57,54,32,49,50,56,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,54,52,57,54,32,49,54,48,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,54,52,57,54,32,49,57,50,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,54,52,57,54,32,50,50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,54,52,57,54,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,54,52,57,54,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,
-  54,52,57,54,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,
-  52,57,54,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,
-  57,54,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,52,57,
-  54,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,54,52,57,54,
-  32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,54,53,50,56,32,48,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,53,50,56,32,51,50,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,53,50,56,32,54,52,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,54,53,50,56,32,57,54,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,54,53,50,56,32,49,50,56,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,54,53,50,56,32,49,54,48,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,54,53,50,56,32,49,57,50,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,54,53,50,56,32,50,50,52,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,54,53,50,56,32,50,53,54,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,54,53,50,56,32,50,56,56,13,10,49,32,51,50,32,51,50,32,51,50,
-  32,51,50,32,54,53,50,56,32,51,50,48,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,54,53,50,56,32,51,53,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,
-  50,32,54,53,50,56,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,54,53,50,56,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,32,51,50,32,
-  54,53,50,56,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,50,32,54,53,
-  54,48,32,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,53,54,48,32,
-  51,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,53,54,48,32,54,52,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,53,54,48,32,57,54,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,53,54,48,32,49,50,56,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,54,53,54,48,32,49,54,48,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,54,53,54,48,32,49,57,50,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,54,53,54,48,32,50,50,52,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,54,53,54,48,32,50,53,54,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,54,53,54,48,32,50,56,56,13,10,49,32,51,50,32,51,
-  50,32,51,50,32,51,50,32,54,53,54,48,32,51,50,48,13,10,49,32,51,50,32,51,50,
-  32,51,50,32,51,50,32,54,53,54,48,32,51,53,50,13,10,49,32,51,50,32,51,50,32,
-  51,50,32,51,50,32,54,53,54,48,32,51,56,52,13,10,49,32,51,50,32,51,50,32,51,
-  50,32,51,50,32,54,53,54,48,32,52,49,54,13,10,49,32,51,50,32,54,52,32,51,50,
-  32,51,50,32,54,53,54,48,32,52,52,56,13,10,49,32,51,50,32,48,32,51,50,32,51,
-  50,32,54,53,57,50,32,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,
-  53,57,50,32,51,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,53,57,
-  50,32,54,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,53,57,50,32,
-  57,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,53,57,50,32,49,50,
-  56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,53,57,50,32,49,54,48,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,53,57,50,32,49,57,50,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,53,57,50,32,50,50,52,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,53,57,50,32,50,53,54,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,54,53,57,50,32,50,56,56,13,10,49,32,
-  51,50,32,51,50,32,51,50,32,51,50,32,54,53,57,50,32,51,50,48,13,10,49,32,51,
-  50,32,51,50,32,51,50,32,51,50,32,54,53,57,50,32,51,53,50,13,10,49,32,51,50,
-  32,51,50,32,51,50,32,51,50,32,54,53,57,50,32,51,56,52,13,10,49,32,51,50,32,
-  51,50,32,51,50,32,51,50,32,54,53,57,50,32,52,49,54,13,10,49,32,51,50,32,54,
-  52,32,51,50,32,51,50,32,54,53,57,50,32,52,52,56,13,10,49,32,51,50,32,48,32,
-  51,50,32,51,50,32,54,54,50,52,32,48,13,10,49,32,51,50,32,51,50,32,51,50,32,
-  51,50,32,54,54,50,52,32,51,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,
-  32,54,54,50,52,32,54,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,
-  54,50,52,32,57,54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,54,50,
-  52,32,49,50,56,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,54,50,52,
-  32,49,54,48,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,54,50,52,32,
-  49,57,50,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,54,50,52,32,50,
-  50,52,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,54,50,52,32,50,53,
-  54,13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,54,50,52,32,50,56,56,
-  13,10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,54,50,52,32,51,50,48,13,
-  10,49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,54,50,52,32,51,53,50,13,10,
-  49,32,51,50,32,51,50,32,51,50,32,51,50,32,54,54,50,52,32,51,56,52,13,10,49,
-  32,51,50,32,51,50,32,51,50,32,51,50,32,54,54,50,52,32,52,49,54,13,10,49,32,
-  51,50,32,54,52,32,51,50,32,51,50,32,54,54,50,52,32,52,52,56,13,10
+  76,86,76,49,208,0,0,0,15,0,0,0,184,5,0,0,14,0,0,0,96,0,0,0,96,0,32,0,0,0,32,
+  0,0,0,64,0,64,0,0,0,32,0,32,0,32,0,64,0,32,0,0,0,0,0,0,0,64,0,32,0,0,0,96,0,
+  32,0,96,0,64,0,96,0,64,0,64,0,1,2,2,2,2,2,2,2,3,3,3,3,3,3,4,0,0,0,0,0,0,0,0,
+  5,6,6,6,6,6,7,0,0,0,0,0,0,0,0,0,5,6,6,6,6,7,0,0,0,0,0,0,0,0,0,0,8,6,6,6,7,0,
+  0,0,0,0,0,0,0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,0,0,
+  9,6,6,6,6,7,0,0,0,0,0,0,0,0,9,6,6,6,6,6,7,0,0,0,0,0,0,0,9,6,6,6,6,6,6,7,0,0,
+  0,0,0,0,0,8,6,6,6,6,6,6,7,0,0,0,0,0,0,0,8,6,6,6,6,6,6,7,0,0,0,0,0,0,0,8,6,6,
+  6,6,6,6,7,0,0,0,0,0,0,0,8,6,6,6,6,6,6,7,0,0,0,0,0,0,9,6,6,6,6,6,6,6,7,0,0,0,
+  0,0,0,8,6,6,6,6,6,6,6,7,0,0,0,0,0,0,8,6,6,6,6,6,6,6,7,0,0,0,0,0,0,8,6,6,6,6,
+  6,6,6,7,0,0,0,0,0,0,8,6,6,6,6,6,6,6,7,0,0,0,0,0,0,8,6,6,6,6,6,6,6,7,0,0,0,0,
+  0,0,5,6,6,6,6,6,6,6,7,0,0,0,0,0,0,0,5,6,6,6,6,6,6,7,0,0,0,0,0,0,0,0,8,6,6,6,
+  6,6,7,0,0,0,0,0,0,0,0,8,6,6,6,6,6,7,0,0,0,0,0,0,0,0,5,6,6,6,6,6,7,0,0,0,0,0,
+  0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,
+  6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,
+  0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,5,6,6,6,6,7,0,0,0,0,0,0,0,0,0,0,8,6,6,6,
+  7,0,0,0,0,0,0,0,0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,
+  0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,0,0,9,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,
+  0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,5,6,6,6,6,7,0,0,0,0,0,0,0,0,
+  0,0,8,6,6,6,7,0,0,0,0,0,0,0,0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,0,0,0,8,6,6,6,7,0,
+  0,0,0,0,0,0,1,3,3,6,6,6,6,7,0,0,0,0,0,0,0,0,5,6,6,6,6,6,7,0,0,0,0,0,0,0,0,0,
+  8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,1,2,3,6,6,6,6,6,7,0,0,
+  0,0,0,0,0,0,8,6,6,6,6,6,7,0,0,0,0,0,0,0,0,8,6,6,6,6,6,7,0,0,0,0,0,0,0,0,5,6,
+  6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,
+  0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,9,6,6,6,6,6,7,0,0,0,0,1,2,2,2,10,10,
+  6,6,6,6,7,0,0,0,0,0,0,0,0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,0,0,0,8,6,6,6,7,0,0,0,
+  0,0,0,0,0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,0,0,0,8,
+  6,6,6,7,0,0,0,0,0,0,0,0,0,9,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,
+  0,0,0,0,9,6,6,6,6,6,7,0,0,0,0,0,0,0,0,8,6,6,6,6,6,7,0,0,0,0,0,0,0,0,5,6,6,6,
+  6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,
+  0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,1,6,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,
+  6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,
+  0,0,0,5,6,6,6,6,7,0,0,0,0,0,0,0,0,0,0,8,6,6,6,7,0,0,0,0,0,0,11,0,0,0,8,6,6,
+  6,7,0,0,0,0,0,0,12,0,0,0,8,6,6,6,7,0,0,0,0,0,0,12,0,0,0,8,6,6,6,7,0,0,0,0,0,
+  0,12,0,0,0,8,6,6,6,7,0,0,0,0,0,0,13,0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,0,0,0,8,6,
+  6,6,7,0,0,0,0,0,0,0,0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,0,0,0,8,6,6,6,7,0,0,0,0,0,
+  0,0,0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,0,0,9,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,
+  6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,
+  0,0,9,6,6,6,6,6,7,0,0,0,0,0,0,0,0,5,6,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,
+  7,0,0,0,0,0,0,0,0,0,5,6,6,6,6,7,0,0,0,0,0,0,0,0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,
+  0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,0,0,9,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,
+  0,0,0,0,0,0,0,0,9,6,6,6,6,6,7,0,0,0,0,0,0,0,0,8,6,6,6,6,6,7,0,0,0,0,0,0,0,0,
+  8,6,6,6,6,6,7,0,0,0,0,0,0,0,0,5,6,6,6,6,6,7,0,0,0,0,0,0,0,0,0,5,6,6,6,6,7,0,
+  0,0,0,0,0,0,0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,0,0,
+  0,8,6,6,6,7,0,0,0,0,0,0,0,0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,0,0,0,8,6,6,6,7,0,0,
+  0,0,0,0,0,0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,0,0,9,
+  6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,
+  0,0,0,0,0,9,6,6,6,6,6,7,0,0,0,0,0,0,0,0,8,6,6,6,6,6,7,0,0,0,0,0,0,0,9,6,6,6,
+  6,6,6,7,0,0,0,0,0,0,0,8,6,6,6,6,6,6,7,0,0,0,0,0,0,0,8,6,6,6,6,6,6,7,0,0,0,0,
+  0,0,0,8,6,6,6,6,6,6,7,0,0,0,0,0,0,9,6,6,6,6,6,6,6,7,0,0,0,0,0,0,8,6,6,6,6,6,
+  6,6,7,0,0,0,0,0,0,8,6,6,6,6,6,6,6,7,0,0,0,0,0,0,8,6,6,6,6,6,6,6,7,0,0,0,0,0,
+  0,5,6,6,6,6,6,6,6,7,0,0,0,0,0,0,0,8,6,6,6,6,6,6,7,0,0,0,0,0,0,0,5,6,6,6,6,6,
+  6,7,0,0,0,0,0,0,0,0,8,6,6,6,6,6,7,0,0,0,0,0,0,0,0,8,6,6,6,6,6,7,0,0,0,0,0,0,
+  0,0,8,6,6,6,6,6,7,0,0,0,0,0,0,0,0,8,6,6,6,6,6,7,0,0,0,0,0,0,0,0,8,6,6,6,6,6,
+  7,0,0,0,0,0,0,0,0,5,6,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,
+  0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,
+  0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,
+  0,8,6,6,6,6,7,0,0,0,0,0,11,0,0,0,8,6,6,6,6,7,0,0,0,0,0,12,0,0,0,8,6,6,6,6,7,
+  0,0,0,0,0,12,0,0,0,5,6,6,6,6,7,0,0,0,0,0,13,0,0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,
+  0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,0,0,0,8,6,6,6,7,0,0,0,0,0,0,0,0,0,0,8,6,6,6,7,
+  0,0,0,0,0,0,0,0,9,3,6,6,6,6,7,0,0,0,0,0,0,9,3,6,6,6,6,6,6,7,0,0,0,0,0,0,8,6,
+  6,6,6,6,6,6,7,0,0,0,0,0,0,5,10,6,6,6,6,6,6,7,0,0,0,0,0,0,0,0,5,6,6,6,6,6,7,
+  0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,
+  0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,
+  0,0,0,0,0,0,0,9,6,6,6,6,6,7,0,0,0,0,0,0,0,0,8,6,6,6,6,6,7,0,0,0,0,0,0,0,0,8,
+  6,6,6,6,6,7,0,0,0,0,0,0,0,0,8,6,6,6,6,6,7,0,0,0,0,0,0,0,0,8,6,6,6,6,6,7,0,0,
+  0,0,0,0,0,9,6,6,6,6,6,6,7,0,0,0,0,0,0,0,8,6,6,6,6,6,6,7,0,0,0,0,0,0,0,8,6,6,
+  6,6,6,6,7,0,0,0,0,0,0,0,5,10,6,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,
+  0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,
+  6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,
+  0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,
+  6,6,6,7,0,0,0,0,0,0,0,0,0,8,6,6,6,6,7,0,0,0,0,0,0,0,0,9,6,6,6,6,6,7,0,0,0,0,
+  0,0,0,9,6,6,6,6,6,6,7,0,0,0,0,0,0,0,8,6,6,6,6,6,6,7,0,0,0,0,0,0,0,8,6,6,6,6,
+  6,6,7,0,0,0,0,0,0,9,6,6,6,6,6,6,6,7,0,0,0,0,0,0,8,6,6,6,6,6,6,6,7,0,0,0,0,0,
+  0,8,6,6,6,6,6,6,6,7,0,0,0,0,0,0,8,6,6,6,6,6,6,6,7,0,0,0,0,0,0,8,6,6,6,6,6,6,
+  6,7,0,0,0,0,0,0,8,6,6,6,6,6,6,6,7,0,0,0,0,0,1,6,6,6,6,6,6,6,6,7,0,0,0,0,0,0,
+  8,6,6,6,6,6,6,6,7,0,0,0,0,0,0,8,6,6,6,6,6,6,6,7,0,0,0,0,0,9,6,6,6,6,6,6,6,6,
+  7,0,0,0,0,0,8,6,6,6,6,6,6,6,6,7,0,0,0,0,1,10,6,6,6,6,6,6,6,6,7,0,0,0,0,0,0,
+  8,6,6,6,6,6,6,6,7,0,0,0,0,0,0,8,6,6,6,6,6,6,6,7,0,0,0,0,0,0,5,6,6,6,6,6,6,6,
+  7,0,0,0,0,0,0,0,8,6,6,6,6,6,6,7,0,0,0,0,0,0,0,8,6,6,6,6,6,6,7,0,0,0,0,0,0,0,
+  5,10,10,10,10,10,10,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,9,3,3,3,3,3,3,3,3,3,3,3,3,3,4,8,6,6,6,6,6,6,6,6,6,6,6,
+  6,6,7,8,6,6,6,6,6,6,6,6,6,6,6,6,6,7,8,6,6,6,6,6,6,6,6,6,6,6,6,6,7,8,6,6,6,6,
+  6,6,6,6,6,6,6,6,6,7,8,6,6,6,6,6,6,6,6,6,6,6,6,6,7,8,6,6,6,6,6,6,6,6,6,6,6,6,
+  6,7,8,6,6,6,6,6,6,6,6,6,6,6,6,6,7,8,6,6,6,6,6,6,6,6,6,6,6,6,6,7
 };
-
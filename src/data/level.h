@@ -1,2 +1,2 @@
-extern unsigned int level_txt_length;
-extern unsigned char level_txt_data[34547];
+extern unsigned int level_lvl_length;
+extern unsigned char level_lvl_data[3196];
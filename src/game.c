@@ -1,4 +1,6 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <allegro5/allegro.h>
 #include <allegro5/allegro_image.h>
 #include <allegro5/allegro_primitives.h>
@@ -8,28 +10,53 @@
 #include <allegro5/allegro_memfile.h>
 #include "game.h"
 #include "state.h"
+#include "profile.h"
+#include "trace.h"
+#include "latency.h"
+#include "input.h"
 
 static struct // Game data
 {
     ALLEGRO_DISPLAY* display;
     ALLEGRO_BITMAP* buffer;
+    ALLEGRO_BITMAP* screen; // Stands in for the display when headless
     ALLEGRO_TIMER* timer;
     ALLEGRO_EVENT_QUEUE* event_queue;
     int initialized;
     int is_running;
     ALLEGRO_COLOR bg_color;
+
+    // Updates run every 1 / framerate seconds, and frames are drawn as often
+    // as the display refreshes, somewhere in between two updates
+    int refresh_rate;
+    double last_time;       // When the time was last added to 'lag'
+    double lag;             // Time the updates are behind of
+    float interpolation;    // See get_interpolation()
+
+    double flip_time;       // When the last flip started
+    double tick_time;       // See get_tick_time()
 }
 game =
 {
-    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL,
     0, 0,
-    { 0, 0, 0, 0 }
+    { 0, 0, 0, 0 },
+    0, 0, 0, 1,
+    0, 0
 };
 
 struct Game_Config* game_config;
 ALLEGRO_FONT* font;
 
 #define MAX_STATES  8
+
+// Most updates run in a row to catch up after a slow frame; time beyond
+// that is dropped, so the game slows down instead of falling further behind
+#define MAX_CATCHUP 4
+
+// Low latency mode wakes up this much earlier than it predicts it has to,
+// as sleeping isn't that precise
+#define WAKE_MARGIN 0.002
 static struct State* states[MAX_STATES];
 static int current_state = 0;
 
@@ -54,6 +81,137 @@ static void aspect_ratio_transform()
     al_use_transform(&trans);
 }
 
+// Command line options:
+//   --headless     Run without display, audio or input
+//   --draw         Still call draw() when headless (into a memory bitmap)
+//   --ticks N      Quit after N updates
+//   --record FILE  Save the input of the game to FILE
+//   --replay FILE  Play the game with the input saved in FILE
+//   --level FILE   Play FILE (level.txt format or compiled with levelc)
+//   --timings FILE Write how long every part of every frame took to FILE
+//   --histogram FILE  Write a histogram of the frame times to FILE at exit
+//   --render-stats FILE  Write what was drawn every frame to FILE
+//   --trace FILE   Write a Chrome trace of the last frames at exit (or F12)
+//   --low-latency  Read the keyboard right before updating, and draw straight
+//                  to the screen (reports the input latency at exit)
+//   --latency FILE Report the input latency at exit, adding it to FILE
+//   --no-vsync     Don't wait for the vertical retrace when flipping
+//   --input-thread Sample the keyboard on its own thread (input.h)
+static void parse_args(struct Game_Config* config, int argc, char** argv)
+{
+    int i;
+
+    for (i=1; i<argc; ++i)
+    {
+        if (strcmp(argv[i], "--headless") == 0)
+        {
+            config->headless = 1;
+        }
+        else if (strcmp(argv[i], "--draw") == 0)
+        {
+            config->headless_draw = 1;
+        }
+        else if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc)
+        {
+            config->max_ticks = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc)
+        {
+            config->record = argv[++i];
+        }
+        else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc)
+        {
+            config->replay = argv[++i];
+        }
+        else if (strcmp(argv[i], "--level") == 0 && i + 1 < argc)
+        {
+            config->level = argv[++i];
+        }
+        else if (strcmp(argv[i], "--timings") == 0 && i + 1 < argc)
+        {
+            config->timings = argv[++i];
+        }
+        else if (strcmp(argv[i], "--histogram") == 0 && i + 1 < argc)
+        {
+            profile_set_histogram(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--render-stats") == 0 && i + 1 < argc)
+        {
+            config->render_stats = argv[++i];
+        }
+        else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+        {
+            config->trace = argv[++i];
+        }
+        else if (strcmp(argv[i], "--low-latency") == 0)
+        {
+            config->low_latency = 1;
+        }
+        else if (strcmp(argv[i], "--no-vsync") == 0)
+        {
+            config->no_vsync = 1;
+        }
+        else if (strcmp(argv[i], "--latency") == 0 && i + 1 < argc)
+        {
+            config->latency = argv[++i];
+            latency_set_csv(config->latency);
+        }
+        else if (strcmp(argv[i], "--input-thread") == 0)
+        {
+            config->input_thread = 1;
+        }
+        else
+        {
+            printf("WARNING: Unknown option %s\n", argv[i]);
+        }
+    }
+
+    if (config->headless)
+    {
+        config->audio = 0;
+        config->fullscreen = 0;
+    }
+}
+
+// Only what's needed to run the states without a display
+static int headless_init(struct Game_Config* config)
+{
+    if (!al_init_image_addon())
+    {
+        puts("ERROR: Could not initialize image addon...");
+        return 0;
+    }
+
+    if (!al_init_primitives_addon())
+    {
+        puts("ERROR: Could not initialize primitives addon...");
+        return 0;
+    }
+
+    al_init_font_addon();
+
+    // There's no display to make video bitmaps for
+    al_set_new_bitmap_flags(ALLEGRO_MEMORY_BITMAP);
+
+    font = al_create_builtin_font();
+    game.buffer = al_create_bitmap(config->width, config->height);
+
+    // What the buffer is copied to instead of the backbuffer, so drawing
+    // costs the same
+    if (config->headless_draw)
+    {
+        game.screen = al_create_bitmap(config->width, config->height);
+    }
+
+    game_config = config;
+
+    game.bg_color = al_map_rgb(192, 192, 192);
+    game.initialized = 1;
+    game.is_running = 1;
+
+    return 1;
+}
+
 int game_init(struct Game_Config* config, int argc, char** argv)
 {
     int i;
@@ -69,9 +227,32 @@ int game_init(struct Game_Config* config, int argc, char** argv)
         states[current_state] = NULL;
     }
 
+    parse_args(config, argc, argv);
+
     // Initialize Allegro and stuff
     al_init();
 
+    if (config->timings != NULL && !profile_open_csv(config->timings))
+    {
+        return 0;
+    }
+
+    if (config->render_stats != NULL
+        && !profile_open_stats_csv(config->render_stats))
+    {
+        return 0;
+    }
+
+    if (config->trace != NULL && !trace_open(config->trace))
+    {
+        return 0;
+    }
+
+    if (config->headless)
+    {
+        return headless_init(config);
+    }
+
     if (!al_install_keyboard())
     {
         puts("ERROR: Could not initialize the keyboard...");
@@ -121,6 +302,11 @@ int game_init(struct Game_Config* config, int argc, char** argv)
         al_set_new_display_flags(ALLEGRO_FULLSCREEN_WINDOW);
     }
 
+    // Wait for the vertical retrace when flipping (if the driver lets us),
+    // or ask for it to be off (2)
+    al_set_new_display_option(ALLEGRO_VSYNC, config->no_vsync ? 2 : 1,
+        ALLEGRO_SUGGEST);
+
     // Create our display
     game.display = al_create_display(config->width, config->height);
 
@@ -132,6 +318,14 @@ int game_init(struct Game_Config* config, int argc, char** argv)
 
     al_set_window_title(game.display, config->title);
 
+    // Not every driver knows it
+    game.refresh_rate = al_get_display_refresh_rate(game.display);
+
+    if (game.refresh_rate <= 0)
+    {
+        game.refresh_rate = 60;
+    }
+
     // Use built-in Allegro font
     font = al_create_builtin_font();
 
@@ -142,7 +336,8 @@ int game_init(struct Game_Config* config, int argc, char** argv)
     game_config = config;
     aspect_ratio_transform();
 
-    game.timer = al_create_timer(1.0 / config->framerate);
+    // Ticks once per frame, the updates keep their own time
+    game.timer = al_create_timer(1.0 / game.refresh_rate);
     game.event_queue = al_create_event_queue();
 
     game.bg_color = al_map_rgb(192, 192, 192);
@@ -152,9 +347,383 @@ int game_init(struct Game_Config* config, int argc, char** argv)
     return 1;
 }
 
+// Updates as fast as possible, with no events
+static void run_headless()
+{
+    int ticks = 0;
+    double start = al_get_time();
+    double elapsed;
+
+    while (game.is_running
+        && (game_config->max_ticks == 0 || ticks < game_config->max_ticks))
+    {
+        trace_begin("tick");
+
+        profile_begin(PHASE_UPDATE);
+        states[current_state]->update();
+        profile_end(PHASE_UPDATE);
+        profile_count(STAT_UPDATES, 1);
+        ++ticks;
+
+        if (game_config->headless_draw && game.is_running)
+        {
+            profile_begin(PHASE_DRAW);
+            al_set_target_bitmap(game.buffer);
+            al_clear_to_color(game.bg_color);
+            states[current_state]->draw();
+            profile_end(PHASE_DRAW);
+
+            profile_begin(PHASE_BLIT);
+            al_set_target_bitmap(game.screen);
+            al_draw_bitmap(game.buffer, 0, 0, 0);
+            profile_end(PHASE_BLIT);
+        }
+
+        profile_frame();
+        trace_end("tick");
+    }
+
+    elapsed = al_get_time() - start;
+
+    printf("Headless: %d ticks in %.3f s (%.0f ticks/s)\n", ticks, elapsed,
+        elapsed > 0 ? ticks / elapsed : 0);
+}
+
+static void end_states()
+{
+    int i;
+
+    for (i=0; i<MAX_STATES; ++i)
+    {
+        if (states[i] != NULL)
+        {
+            states[i]->end();
+        }
+    }
+}
+
+// Passes an event to the state, and handles the window and the keys of the
+// game itself; key events aren't passed unless 'keys_to_state' (in low
+// latency mode the state gets them from the keyboard state instead)
+static void handle_event(ALLEGRO_EVENT* event, int keys_to_state)
+{
+    int is_key = (event->type == ALLEGRO_EVENT_KEY_DOWN
+        || event->type == ALLEGRO_EVENT_KEY_UP);
+
+    if (event->type == ALLEGRO_EVENT_KEY_DOWN)
+    {
+        int keycode = event->keyboard.keycode;
+        int key = LATENCY_KEY_OTHER;
+
+        // The keys Luna is moved with
+        if (keycode == ALLEGRO_KEY_LEFT || keycode == ALLEGRO_KEY_RIGHT)
+        {
+            key = LATENCY_KEY_MOVE;
+        }
+        else if (keycode == ALLEGRO_KEY_UP)
+        {
+            key = LATENCY_KEY_JUMP;
+        }
+
+        latency_key_down(event->keyboard.timestamp, key);
+    }
+
+    if (!is_key || keys_to_state)
+    {
+        profile_begin(PHASE_EVENTS);
+        states[current_state]->events(event);
+        profile_end(PHASE_EVENTS);
+    }
+
+    if (event->type == ALLEGRO_EVENT_KEY_DOWN)
+    {
+        latency_stage(LATENCY_EVENTS, al_get_time());
+    }
+
+    // If the close button was pressed...
+    if (event->type == ALLEGRO_EVENT_DISPLAY_CLOSE)
+    {
+        game.is_running = 0;
+    }
+    else if (event->type == ALLEGRO_EVENT_KEY_DOWN)
+    {
+        // Escape key will end the game
+        if (event->keyboard.keycode == ALLEGRO_KEY_ESCAPE)
+        {
+            game.is_running = 0;
+        }
+
+        // The F4 key will switch between screen modes (mantaining aspect ratio)
+        // Inspired by Game Maker.
+        if (event->keyboard.keycode == ALLEGRO_KEY_F4)
+        {
+            if (al_get_display_flags(game.display) & ALLEGRO_FULLSCREEN_WINDOW)
+            {
+                al_toggle_display_flag(game.display, ALLEGRO_FULLSCREEN_WINDOW, 0);
+            }
+            else
+            {
+                al_toggle_display_flag(game.display, ALLEGRO_FULLSCREEN_WINDOW, 1);
+            }
+
+            aspect_ratio_transform();
+        }
+
+        // F3 shows how long the frames take
+        if (event->keyboard.keycode == ALLEGRO_KEY_F3)
+        {
+            profile_toggle_overlay();
+        }
+
+        // F12 writes the trace so far
+        if (event->keyboard.keycode == ALLEGRO_KEY_F12)
+        {
+            trace_flush();
+        }
+    }
+}
+
+// Runs the updates that are due by now; what's left over tells how far the
+// frame is between the last two
+static void run_updates()
+{
+    double now = al_get_time();
+    double tick = 1.0 / game_config->framerate;
+    int updates = 0;
+
+    game.lag += now - game.last_time;
+    game.last_time = now;
+
+    while (game.lag >= tick && updates < MAX_CATCHUP && game.is_running)
+    {
+        game.tick_time = now - (game.lag - tick);
+
+        profile_begin(PHASE_UPDATE);
+        states[current_state]->update();
+        profile_end(PHASE_UPDATE);
+        game.lag -= tick;
+        ++updates;
+    }
+
+    profile_count(STAT_UPDATES, updates);
+
+    // Too far behind, so whole updates are skipped
+    if (game.lag >= tick && game.is_running)
+    {
+        int dropped = game.lag / tick;
+
+        game.lag -= dropped * tick;
+        profile_count(STAT_DROPPED, dropped);
+    }
+
+    game.interpolation = game.lag / tick;
+}
+
+// Keeps drawing inside the game screen when drawing straight to the
+// backbuffer
+static void clip_to_screen()
+{
+    float x1 = 0, y1 = 0;
+    float x2 = SCREEN_W, y2 = SCREEN_H;
+
+    al_transform_coordinates(al_get_current_transform(), &x1, &y1);
+    al_transform_coordinates(al_get_current_transform(), &x2, &y2);
+    al_set_clipping_rectangle(x1, y1, x2 - x1, y2 - y1);
+}
+
+static void draw_frame()
+{
+    profile_begin(PHASE_DRAW);
+
+    // Low latency mode draws straight to the backbuffer (scaled by its
+    // transform), skipping the copy of the buffer
+    if (game_config->low_latency)
+    {
+        al_set_target_backbuffer(game.display);
+        al_clear_to_color(C_BLACK);
+        clip_to_screen();
+    }
+    else
+    {
+        al_set_target_bitmap(game.buffer);
+    }
+
+    al_clear_to_color(game.bg_color);
+
+    states[current_state]->draw();
+
+    profile_end(PHASE_DRAW);
+    latency_stage(LATENCY_DRAW, al_get_time());
+
+    // Not part of the draw time
+    profile_draw_overlay(8, 8, 1.0 / game.refresh_rate);
+
+    if (game_config->low_latency)
+    {
+        al_reset_clipping_rectangle();
+    }
+    else
+    {
+        profile_begin(PHASE_BLIT);
+
+        al_set_target_backbuffer(game.display);
+
+        al_clear_to_color(C_BLACK);
+
+        al_draw_bitmap(game.buffer, 0, 0, 0);
+
+        profile_end(PHASE_BLIT);
+    }
+
+    game.flip_time = al_get_time();
+    profile_begin(PHASE_FLIP);
+
+    al_flip_display();
+
+    profile_end(PHASE_FLIP);
+    latency_stage(LATENCY_FLIP, al_get_time());
+    profile_frame();
+}
+
+// Passes what changed on the keyboard to the state, as key events
+static void send_key_changes(ALLEGRO_KEYBOARD_STATE* before,
+  ALLEGRO_KEYBOARD_STATE* now, double time)
+{
+    int k;
+    ALLEGRO_EVENT event;
+
+    memset(&event, 0, sizeof(event));
+
+    for (k=1; k<ALLEGRO_KEY_MAX; ++k)
+    {
+        int down = al_key_down(now, k);
+
+        if (down == al_key_down(before, k))
+        {
+            continue;
+        }
+
+        event.type = (down ? ALLEGRO_EVENT_KEY_DOWN : ALLEGRO_EVENT_KEY_UP);
+        event.keyboard.timestamp = time;
+        event.keyboard.display = game.display;
+        event.keyboard.keycode = k;
+
+        profile_begin(PHASE_EVENTS);
+        states[current_state]->events(&event);
+        profile_end(PHASE_EVENTS);
+    }
+}
+
+// Instead of waiting for the timer, sleeps until just before the next frame
+// is due, then reads the keyboard, updates, draws and flips right away
+static void run_low_latency()
+{
+    ALLEGRO_KEYBOARD_STATE keys, last_keys;
+    double period = 1.0 / game.refresh_rate;
+    double deadline, now;
+
+    // Predicted time from reading the keys to the flip
+    double work = 0;
+
+    // The flip ends at the retrace with vsync, so frames follow it
+    int vsync = (al_get_display_option(game.display, ALLEGRO_VSYNC) == 1);
+
+    al_get_keyboard_state(&last_keys);
+    game.last_time = al_get_time();
+    deadline = game.last_time + period;
+
+    while (game.is_running)
+    {
+        ALLEGRO_EVENT event;
+        double start, wake = deadline - work - WAKE_MARGIN;
+
+        if (wake > al_get_time())
+        {
+            al_rest(wake - al_get_time());
+        }
+
+        trace_begin("game_run");
+
+        start = al_get_time();
+        al_get_keyboard_state(&keys);
+        send_key_changes(&last_keys, &keys, start);
+        last_keys = keys;
+
+        // The keys were already read; key events here are only measured
+        // for latency, and checked for the keys of the game itself
+        while (game.is_running
+            && al_get_next_event(game.event_queue, &event))
+        {
+            handle_event(&event, 0);
+        }
+
+        if (!game.is_running)
+        {
+            trace_end("game_run");
+            break;
+        }
+
+        run_updates();
+        draw_frame();
+
+        // Goes up at once and down slowly, so a single quick frame doesn't
+        // make the next one late
+        if (game.flip_time - start > work)
+        {
+            work = game.flip_time - start;
+        }
+        else
+        {
+            work = work * 0.95 + (game.flip_time - start) * 0.05;
+        }
+
+        now = al_get_time();
+        deadline = (vsync ? now : deadline) + period;
+
+        // Too late for this one already, so no sleeping
+        if (deadline < now)
+        {
+            deadline = now;
+        }
+
+        trace_end("game_run");
+    }
+}
+
+// How frames are paced, for the latency report, as in "timer 30tps 60Hz
+// vsync" (30 updates per second on a 60Hz display)
+static void describe_pacing(char* mode, int size)
+{
+    int vsync = al_get_display_option(game.display, ALLEGRO_VSYNC);
+
+    snprintf(mode, size, "%s %dtps %dHz %s%s",
+        game_config->low_latency ? "low-latency" : "timer",
+        game_config->framerate, game.refresh_rate,
+        vsync == 1 ? "vsync" : (vsync == 2 ? "no-vsync" : "vsync-unknown"),
+        input_is_running() ? " input-thread" : "");
+}
+
 void game_run()
 {
-    int i, redraw = 0;
+    int redraw = 0;
+
+    if (game_config->headless)
+    {
+        run_headless();
+
+        end_states();
+        profile_close();
+        trace_close();
+
+        if (game.screen != NULL)
+        {
+            al_destroy_bitmap(game.screen);
+        }
+
+        al_destroy_bitmap(game.buffer);
+        al_destroy_font(font);
+        return;
+    }
 
     // Register event sources
     al_register_event_source(game.event_queue,
@@ -166,10 +735,25 @@ void game_run()
     al_register_event_source(game.event_queue,
         al_get_mouse_event_source());
 
-    al_register_event_source(game.event_queue,
-        al_get_timer_event_source(game.timer));
+    // Nothing to sample when the keys come from a replay; if the thread
+    // can't start, the keys come from events as usual
+    if (game_config->input_thread && game_config->replay == NULL)
+    {
+        input_start();
+    }
+
+    if (game_config->low_latency && game.is_running)
+    {
+        run_low_latency();
+    }
+    else
+    {
+        al_register_event_source(game.event_queue,
+            al_get_timer_event_source(game.timer));
 
-    al_start_timer(game.timer);
+        al_start_timer(game.timer);
+        game.last_time = al_get_time();
+    }
 
     // Main game loop
     while (game.is_running)
@@ -177,74 +761,54 @@ void game_run()
         ALLEGRO_EVENT event;
         al_wait_for_event(game.event_queue, &event);
 
-        // Event processing
-        states[current_state]->events(&event);
+        trace_begin("game_run");
+
+        handle_event(&event, 1);
 
-        // If the close button was pressed...
-        if (event.type == ALLEGRO_EVENT_DISPLAY_CLOSE)
+        if (!game.is_running)
         {
-            game.is_running = 0;
+            trace_end("game_run");
             break;
         }
-        else if (event.type == ALLEGRO_EVENT_KEY_DOWN)
+
+        if (event.type == ALLEGRO_EVENT_TIMER)
         {
-            // Escape key will end the game
-            if (event.keyboard.keycode == ALLEGRO_KEY_ESCAPE)
-            {
-                game.is_running = 0;
-                break;
-            }
+            ALLEGRO_EVENT next;
 
-            // The F4 key will switch between screen modes (mantaining aspect ratio)
-            // Inspired by Game Maker.
-            if (event.keyboard.keycode == ALLEGRO_KEY_F4)
+            // Timer events that piled up during a slow frame make a single
+            // one, as the updates go by the clock anyway
+            while (al_peek_next_event(game.event_queue, &next)
+                && next.type == ALLEGRO_EVENT_TIMER)
             {
-                if (al_get_display_flags(game.display) & ALLEGRO_FULLSCREEN_WINDOW)
-                {
-                    al_toggle_display_flag(game.display, ALLEGRO_FULLSCREEN_WINDOW, 0);
-                }
-                else
-                {
-                    al_toggle_display_flag(game.display, ALLEGRO_FULLSCREEN_WINDOW, 1);
-                }
-
-                aspect_ratio_transform();
+                al_drop_next_event(game.event_queue);
             }
-        }
-        else if (event.type == ALLEGRO_EVENT_TIMER)
-        {
-            states[current_state]->update();
+
+            run_updates();
             redraw = 1;
         }
 
         if (redraw && al_event_queue_is_empty(game.event_queue))
         {
             redraw = 0;
-
-            al_set_target_bitmap(game.buffer);
-
-            al_clear_to_color(game.bg_color);
-
-            states[current_state]->draw();
-
-            al_set_target_backbuffer(game.display);
-
-            al_clear_to_color(C_BLACK);
-
-            al_draw_bitmap(game.buffer, 0, 0, 0);
-
-            al_flip_display();
+            draw_frame();
         }
+
+        trace_end("game_run");
     }
 
-    for (i=0; i<MAX_STATES; ++i)
+    if (game_config->low_latency || game_config->latency != NULL)
     {
-        if (states[i] != NULL)
-        {
-            states[i]->end();
-        }
+        char mode[64];
+
+        describe_pacing(mode, sizeof(mode));
+        latency_report(mode);
     }
 
+    input_stop();
+    end_states();
+    profile_close();
+    trace_close();
+
     al_destroy_display(game.display);
     al_destroy_bitmap(game.buffer);
     al_destroy_timer(game.timer);
@@ -257,6 +821,16 @@ void game_over()
     game.is_running = 0;
 }
 
+float get_interpolation()
+{
+    return game.interpolation;
+}
+
+double get_tick_time()
+{
+    return game.tick_time;
+}
+
 void set_bg_color(ALLEGRO_COLOR color)
 {
     game.bg_color = color;
@@ -269,54 +843,92 @@ ALLEGRO_BITMAP* bitmap_from_data(void* data, unsigned int length,
 
     ALLEGRO_FILE* f = al_open_memfile(data, length, "r");
 
+    trace_begin("bitmap_from_data");
+
     if (f != NULL)
     {
         bmp = al_load_bitmap_f(f, type);
         al_fclose(f);
     }
 
+    trace_end("bitmap_from_data");
+
     return bmp;
 }
 
 void change_state(struct State* state, void* param)
 {
+    trace_begin("change_state");
+
     if (states[current_state] != NULL)
     {
+        trace_begin("end");
         states[current_state]->end();
+        trace_end("end");
     }
 
     states[current_state] = state;
+
+    // The moment the running state is another one, as a marker in the trace
+    trace_instant("state_switch");
+
+    trace_begin("init");
     state->init(param);
+    trace_end("init");
+
+    trace_end("change_state");
 }
 
 void push_state(struct State* state, void* param)
 {
+    trace_begin("push_state");
+
     if (current_state < (MAX_STATES - 1))
     {
         if (states[current_state] != NULL)
         {
+            trace_begin("pause");
             states[current_state]->pause();
+            trace_end("pause");
         }
 
         states[++current_state] = state;
+        trace_instant("state_switch");
+
+        trace_begin("init");
         state->init(param);
+        trace_end("init");
     }
     else
     {
         puts("WARNING: Can't add new state (current_state = MAX_STATES)");
     }
+
+    trace_end("push_state");
 }
 
 void pop_state()
 {
+    trace_begin("pop_state");
+
     if (current_state > 0)
     {
+        trace_begin("end");
         states[current_state]->end();
+        trace_end("end");
+
         states[current_state] = NULL;
-        states[--current_state]->resume();
+        --current_state;
+        trace_instant("state_switch");
+
+        trace_begin("resume");
+        states[current_state]->resume();
+        trace_end("resume");
     }
     else
     {
         puts("WARNING: Can't remove any more states (current_state = 0)");
     }
+
+    trace_end("pop_state");
 }
@@ -15,6 +15,21 @@ struct Game_Config
     int framerate;
     int fullscreen;
     int audio;
+
+    // Set from the command line (see game_init)
+    int headless;       // No display, audio or input, update as fast as possible
+    int headless_draw;  // Draw into a memory bitmap when running headless
+    int max_ticks;      // Stop after this many updates (0 = never)
+    char* record;       // Save the keys of every tick to this file
+    char* replay;       // Play back keys saved with 'record' instead of input
+    char* level;        // Level file to play instead of the embedded one
+    char* timings;      // CSV file for the time every frame took (profile.h)
+    char* trace;        // Chrome trace of the last frames (trace.h)
+    char* render_stats; // CSV file for what was drawn every frame (profile.h)
+    int low_latency;    // Poll the keyboard right before updating (game_run)
+    int no_vsync;       // Flip without waiting for the vertical retrace
+    int input_thread;   // Sample the keyboard on its own thread (input.h)
+    char* latency;      // CSV file the input latency is added to (latency.h)
 };
 
 // Pointer to the original game settings (main.c)
@@ -31,6 +46,15 @@ int game_init(struct Game_Config* config, int argc, char** argv);
 void game_run();
 void game_over();
 void set_bg_color(ALLEGRO_COLOR);
+
+// Where the frame being drawn falls between the last two updates, from 0
+// (the one before last) to 1 (the last one), to draw moving things smoothly
+// at any frame rate
+float get_interpolation();
+
+// The time (on the al_get_time() clock) the running update brings the game
+// up to, so input can be split between updates by when it happened
+double get_tick_time();
 ALLEGRO_BITMAP* bitmap_from_data(void*, unsigned int length, const char* type);
 
 struct State;
@@ -0,0 +1,242 @@
+// Keyboard sampling thread, passing changes to the game through a
+// single-producer single-consumer ring
+
+#include <stdio.h>
+#include <allegro5/allegro.h>
+#include "input.h"
+#include "player.h"
+
+struct Sample
+{
+    struct Keys keys;
+    double time;
+};
+
+static struct
+{
+    ALLEGRO_THREAD* thread;
+
+    // Written by the thread (head) and by the game (tail) only; they keep
+    // counting up, and the ring is empty when they're equal
+    struct Sample ring[INPUT_RING];
+    unsigned int head;
+    unsigned int tail;
+    int overflows;
+
+    // What the game saw last: keys physically down, taps to let go of on
+    // the next tick, and where the last tick ended
+    struct Keys down;
+    struct Keys release;
+    double time;
+}
+input;
+
+static void read_keys(ALLEGRO_KEYBOARD_STATE* state, struct Keys* keys)
+{
+    keys->left = al_key_down(state, ALLEGRO_KEY_LEFT);
+    keys->right = al_key_down(state, ALLEGRO_KEY_RIGHT);
+    keys->jump = al_key_down(state, ALLEGRO_KEY_UP);
+    keys->run = al_key_down(state, ALLEGRO_KEY_LSHIFT)
+        || al_key_down(state, ALLEGRO_KEY_RSHIFT);
+}
+
+static int same_keys(struct Keys* a, struct Keys* b)
+{
+    return a->left == b->left && a->right == b->right && a->run == b->run
+        && a->jump == b->jump;
+}
+
+// Only changes go into the ring
+static void* sample_keys(ALLEGRO_THREAD* thread, void* arg)
+{
+    ALLEGRO_KEYBOARD_STATE state;
+    struct Sample sample, last;
+
+    al_get_keyboard_state(&state);
+    read_keys(&state, &last.keys);
+
+    while (!al_get_thread_should_stop(thread))
+    {
+        unsigned int head;
+
+        al_rest(1.0 / INPUT_RATE);
+
+        al_get_keyboard_state(&state);
+        read_keys(&state, &sample.keys);
+
+        if (same_keys(&sample.keys, &last.keys))
+        {
+            continue;
+        }
+
+        sample.time = al_get_time();
+        head = __atomic_load_n(&input.head, __ATOMIC_RELAXED);
+
+        // Full: the game isn't updating, so the change is lost
+        if (head - __atomic_load_n(&input.tail, __ATOMIC_ACQUIRE)
+            == INPUT_RING)
+        {
+            ++input.overflows;
+            continue;
+        }
+
+        input.ring[head % INPUT_RING] = sample;
+        __atomic_store_n(&input.head, head + 1, __ATOMIC_RELEASE);
+
+        last = sample;
+    }
+
+    return NULL;
+}
+
+int input_start()
+{
+    ALLEGRO_KEYBOARD_STATE state;
+    struct Keys none = { 0, 0, 0, 0, 0, 0 };
+
+    if (input.thread != NULL)
+    {
+        return 1;
+    }
+
+    al_get_keyboard_state(&state);
+    read_keys(&state, &input.down);
+    input.release = none;
+    input.time = al_get_time();
+    input.head = 0;
+    input.tail = 0;
+    input.overflows = 0;
+
+    input.thread = al_create_thread(sample_keys, NULL);
+
+    if (input.thread == NULL)
+    {
+        puts("WARNING: Could not start the input thread");
+        return 0;
+    }
+
+    al_start_thread(input.thread);
+
+    return 1;
+}
+
+void input_stop()
+{
+    if (input.thread == NULL)
+    {
+        return;
+    }
+
+    al_join_thread(input.thread, NULL);
+    al_destroy_thread(input.thread);
+    input.thread = NULL;
+
+    if (input.overflows > 0)
+    {
+        printf("WARNING: %d key changes were lost\n", input.overflows);
+    }
+}
+
+int input_is_running()
+{
+    return input.thread != NULL;
+}
+
+// Applies one key going down or up: a key that was down at any point of
+// the tick counts as held for the tick, and is let go of on the next one
+static void change_key(int* key, int* down, int* release, int now)
+{
+    if (now == *down)
+    {
+        return;
+    }
+
+    *down = now;
+
+    if (now)
+    {
+        *key = 1;
+        *release = 0;
+    }
+    else
+    {
+        *release = 1;
+    }
+}
+
+void input_tick(struct Keys* keys, double time)
+{
+    struct Keys none = { 0, 0, 0, 0, 0, 0 };
+    double held_left = 0, held_right = 0;
+    double t = input.time;
+    unsigned int tail = input.tail;
+
+    // Keys let go of during the last tick
+    if (input.release.left)
+    {
+        keys->left = 0;
+    }
+
+    if (input.release.right)
+    {
+        keys->right = 0;
+    }
+
+    if (input.release.run)
+    {
+        keys->run = 0;
+    }
+
+    if (input.release.jump)
+    {
+        keys->jump = 0;
+    }
+
+    input.release = none;
+
+    while (tail != __atomic_load_n(&input.head, __ATOMIC_ACQUIRE))
+    {
+        struct Sample* s = &input.ring[tail % INPUT_RING];
+
+        // Belongs to a later tick
+        if (s->time > time)
+        {
+            break;
+        }
+
+        held_left += (input.down.left ? s->time - t : 0);
+        held_right += (input.down.right ? s->time - t : 0);
+        t = s->time;
+
+        change_key(&keys->left, &input.down.left, &input.release.left,
+            s->keys.left);
+        change_key(&keys->right, &input.down.right, &input.release.right,
+            s->keys.right);
+        change_key(&keys->run, &input.down.run, &input.release.run,
+            s->keys.run);
+        change_key(&keys->jump, &input.down.jump, &input.release.jump,
+            s->keys.jump);
+
+        ++tail;
+    }
+
+    __atomic_store_n(&input.tail, tail, __ATOMIC_RELEASE);
+
+    if (time > t)
+    {
+        held_left += (input.down.left ? time - t : 0);
+        held_right += (input.down.right ? time - t : 0);
+    }
+
+    if (time > input.time)
+    {
+        keys->left_held = held_left / (time - input.time);
+        keys->right_held = held_right / (time - input.time);
+        input.time = time;
+    }
+    else
+    {
+        keys->left_held = keys->left;
+        keys->right_held = keys->right;
+    }
+}
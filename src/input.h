@@ -0,0 +1,24 @@
+#ifndef INPUT_H_INCLUDED
+#define INPUT_H_INCLUDED
+
+struct Keys;
+
+// Keyboard sampled on its own thread, so when keys go down and up is known
+// to the millisecond instead of to the tick
+
+// Samples per second (as close as al_rest() gets)
+#define INPUT_RATE      1000
+
+// Key changes waiting for an update (a power of two)
+#define INPUT_RING      1024
+
+int input_start();
+void input_stop();
+int input_is_running();
+
+// Changes the keys with what happened up to 'time' (see get_tick_time()):
+// a tap shorter than the tick still counts as held for the tick, and
+// left_held and right_held get the part of the tick they were down
+void input_tick(struct Keys*, double time);
+
+#endif // INPUT_H_INCLUDED
@@ -0,0 +1,206 @@
+// Input-to-photon latency, as far as the game can see it: the flip ending
+// is the closest thing to the frame reaching the screen
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <allegro5/allegro.h>
+#include "latency.h"
+
+// Every step, then the whole
+#define SERIES      (LATENCY_STAGES + 1)
+
+static const char* stage_names[SERIES] =
+{
+    "queue",
+    "events",
+    "update",
+    "draw",
+    "flip",
+    "total"
+};
+
+struct Press
+{
+    int key;
+    double input;
+    double time[LATENCY_STAGES];
+    int stage;      // Last step reached
+};
+
+static struct
+{
+    struct Press pending[LATENCY_PENDING];
+    int pending_count;
+
+    // In ms
+    double samples[SERIES][LATENCY_SAMPLES];
+    int sample_count;
+
+    int dropped;
+    int timeouts;
+    const char* csv;
+}
+latency;
+
+void latency_key_down(double time, int key)
+{
+    struct Press* p;
+
+    if (latency.pending_count == LATENCY_PENDING)
+    {
+        ++latency.dropped;
+        return;
+    }
+
+    p = &latency.pending[latency.pending_count++];
+    p->key = key;
+    p->input = time;
+    p->time[LATENCY_QUEUE] = al_get_time();
+    p->stage = LATENCY_QUEUE;
+}
+
+static void add_sample(struct Press* p)
+{
+    int i;
+    double last = p->input;
+
+    if (latency.sample_count == LATENCY_SAMPLES)
+    {
+        ++latency.dropped;
+        return;
+    }
+
+    for (i=0; i<LATENCY_STAGES; ++i)
+    {
+        latency.samples[i][latency.sample_count] = (p->time[i] - last) * 1000;
+        last = p->time[i];
+    }
+
+    latency.samples[LATENCY_STAGES][latency.sample_count] =
+        (last - p->input) * 1000;
+
+    ++latency.sample_count;
+}
+
+// Moves the presses waiting for 'stage' to it ('key' -1 for any key)
+static void advance(int stage, int key, double time)
+{
+    int i, kept = 0;
+
+    for (i=0; i<latency.pending_count; ++i)
+    {
+        struct Press* p = &latency.pending[i];
+
+        if (p->stage == stage - 1 && (key == -1 || p->key == key))
+        {
+            p->time[stage] = time;
+            p->stage = stage;
+        }
+
+        if (p->stage == LATENCY_FLIP)
+        {
+            add_sample(p);
+            continue;
+        }
+
+        // Still waiting for Luna to react, or for a frame to show it (there
+        // may be none, like when headless without --draw)
+        if (time - p->input > LATENCY_TIMEOUT)
+        {
+            ++latency.timeouts;
+            continue;
+        }
+
+        latency.pending[kept++] = *p;
+    }
+
+    latency.pending_count = kept;
+}
+
+void latency_stage(int stage, double time)
+{
+    advance(stage, -1, time);
+}
+
+void latency_reaction(int key, double time)
+{
+    advance(LATENCY_UPDATE, key, time);
+}
+
+void latency_set_csv(const char* filename)
+{
+    latency.csv = filename;
+}
+
+static int compare_double(const void* a, const void* b)
+{
+    double d = *(const double*) a - *(const double*) b;
+    return (d > 0) - (d < 0);
+}
+
+// Nearest-rank percentile (samples have to be sorted)
+static double percentile(double* samples, int pct)
+{
+    int i = (latency.sample_count * pct + 99) / 100 - 1;
+    return samples[i < 0 ? 0 : i];
+}
+
+void latency_report(const char* mode)
+{
+    int i;
+    FILE* f = NULL;
+
+    printf("Input latency, %s: %d key presses, %d never shown\n", mode,
+        latency.sample_count, latency.timeouts);
+
+    if (latency.dropped > 0)
+    {
+        printf("WARNING: %d key presses were not measured\n",
+            latency.dropped);
+    }
+
+    if (latency.sample_count == 0)
+    {
+        return;
+    }
+
+    if (latency.csv != NULL)
+    {
+        // Runs are added to the end, to compare pacing modes
+        f = fopen(latency.csv, "a");
+
+        if (f == NULL)
+        {
+            printf("ERROR: Could not write latency to %s\n", latency.csv);
+        }
+        else if (fseek(f, 0, SEEK_END) == 0 && ftell(f) == 0)
+        {
+            fputs("mode,stage,count,p50_ms,p95_ms,p99_ms,max_ms\n", f);
+        }
+    }
+
+    puts("ms       p50    p95    p99    max");
+
+    for (i=0; i<SERIES; ++i)
+    {
+        double* s = latency.samples[i];
+
+        qsort(s, latency.sample_count, sizeof(double), compare_double);
+
+        printf("%-6s %6.1f %6.1f %6.1f %6.1f\n", stage_names[i],
+            percentile(s, 50), percentile(s, 95), percentile(s, 99),
+            percentile(s, 100));
+
+        if (f != NULL)
+        {
+            fprintf(f, "%s,%s,%d,%.3f,%.3f,%.3f,%.3f\n", mode, stage_names[i],
+                latency.sample_count, percentile(s, 50), percentile(s, 95),
+                percentile(s, 99), percentile(s, 100));
+        }
+    }
+
+    if (f != NULL)
+    {
+        fclose(f);
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef LATENCY_H_INCLUDED
+#define LATENCY_H_INCLUDED
+
+// Follows every key press from its event to the end of the flip of the
+// first frame that shows Luna reacting to it
+
+// Steps of a key press, in order; each one is timed from the one before
+enum
+{
+    LATENCY_QUEUE,      // game_run() got the event (from its timestamp)
+    LATENCY_EVENTS,     // The state's events() handled it
+    LATENCY_UPDATE,     // An update changed what Luna does
+    LATENCY_DRAW,       // The frame after that update was drawn
+    LATENCY_FLIP,       // ...and flipped
+    LATENCY_STAGES
+};
+
+// What a key makes Luna do, so a press is only matched with her reacting
+// to that key (presses of other keys time out)
+enum
+{
+    LATENCY_KEY_OTHER,
+    LATENCY_KEY_MOVE,   // Left or right: turning, walking or stopping
+    LATENCY_KEY_JUMP    // Up: a jump starting
+};
+
+// Samples kept for the percentiles, later ones are dropped
+#define LATENCY_SAMPLES     8192
+
+// Most key presses followed at once
+#define LATENCY_PENDING     64
+
+// Presses that don't make it to the screen in this long (like keys the game
+// doesn't use, or when nothing is drawn) are given up on
+#define LATENCY_TIMEOUT     0.5
+
+// A key went down at 'time' (al_get_time() clock, as event timestamps);
+// 'key' is one of the LATENCY_KEY values
+void latency_key_down(double time, int key);
+
+// Every key press waiting for 'stage' reached it at 'time' (any stage but
+// LATENCY_UPDATE, which depends on the key)
+void latency_stage(int stage, double time);
+
+// Luna reacted to 'key' at 'time': presses of that key reach LATENCY_UPDATE
+void latency_reaction(int key, double time);
+
+// Prints the percentiles of every step and of the whole, for the pacing
+// mode described by 'mode', and adds them to a CSV file if one was set
+void latency_set_csv(const char* filename);
+void latency_report(const char* mode);
+
+#endif // LATENCY_H_INCLUDED
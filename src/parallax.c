@@ -0,0 +1,108 @@
+// Background layers scrolling at their own speed
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <allegro5/allegro.h>
+#include "parallax.h"
+#include "profile.h"
+
+struct Layer
+{
+    ALLEGRO_BITMAP* bmp;
+    float factor_x, factor_y;
+    float x, y;
+    int wrap;
+};
+
+struct Parallax
+{
+    struct Layer layers[PARALLAX_LAYERS];
+    int count;
+};
+
+struct Parallax* create_parallax()
+{
+    struct Parallax* p = malloc(sizeof(struct Parallax));
+    p->count = 0;
+    return p;
+}
+
+void destroy_parallax(struct Parallax* p)
+{
+    free(p);
+}
+
+int parallax_add(struct Parallax* p, ALLEGRO_BITMAP* bmp, float factor_x,
+  float factor_y, float x, float y, int wrap)
+{
+    struct Layer* l;
+
+    if (p->count == PARALLAX_LAYERS)
+    {
+        puts("WARNING: Too many parallax layers");
+        return 0;
+    }
+
+    l = &p->layers[p->count++];
+    l->bmp = bmp;
+    l->factor_x = factor_x;
+    l->factor_y = factor_y;
+    l->x = x;
+    l->y = y;
+    l->wrap = wrap;
+
+    return 1;
+}
+
+// First copy to draw along an axis, and where to stop; a layer that doesn't
+// wrap is a single copy
+static void visible_copies(float pos, float size, int view_size, int wrap,
+  float* first, float* last)
+{
+    if (wrap)
+    {
+        *first = pos - ceil(pos / size) * size;
+        *last = view_size;
+    }
+    else
+    {
+        *first = pos;
+        *last = pos + 1;
+    }
+}
+
+void parallax_draw(struct Parallax* p, float view_x, float view_y, int w,
+  int h)
+{
+    int i;
+
+    for (i=0; i<p->count; ++i)
+    {
+        struct Layer* l = &p->layers[i];
+        float bw = al_get_bitmap_width(l->bmp);
+        float bh = al_get_bitmap_height(l->bmp);
+        float x, y, x1, y1, x2, y2;
+
+        // Whole pixels, so copies don't leave gaps between them
+        visible_copies(floor(l->x - view_x * l->factor_x), bw, w,
+            l->wrap & WRAP_X, &x1, &x2);
+        visible_copies(floor(l->y - view_y * l->factor_y), bh, h,
+            l->wrap & WRAP_Y, &y1, &y2);
+
+        for (y=y1; y<y2; y+=bh)
+        {
+            for (x=x1; x<x2; x+=bw)
+            {
+                // Copies that don't wrap may still be off-screen
+                if (x + bw <= 0 || y + bh <= 0 || x >= w || y >= h)
+                {
+                    continue;
+                }
+
+                al_draw_bitmap(l->bmp, x, y, 0);
+                profile_count_blit(l->bmp, x, y, bw, bh);
+            }
+        }
+    }
+}
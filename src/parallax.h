@@ -0,0 +1,33 @@
+#ifndef PARALLAX_H_INCLUDED
+#define PARALLAX_H_INCLUDED
+
+#include <allegro5/allegro.h>
+
+// Most layers a background can have
+#define PARALLAX_LAYERS     8
+
+// How a layer repeats
+enum
+{
+    WRAP_NONE   = 0,
+    WRAP_X      = 1,
+    WRAP_Y      = 2,
+    WRAP_BOTH   = WRAP_X | WRAP_Y
+};
+
+struct Parallax;
+
+struct Parallax* create_parallax();
+void destroy_parallax(struct Parallax*);
+
+// Adds a layer on top of the others; it moves 'factor' times as fast as the
+// camera (0 = fixed on screen, 1 = like the level), and x, y is where its
+// first copy is when the camera is at 0, 0
+// The bitmap is not owned by the layer
+int parallax_add(struct Parallax*, ALLEGRO_BITMAP*, float factor_x,
+    float factor_y, float x, float y, int wrap);
+
+// Draws every layer, only the copies of it that are inside the view
+void parallax_draw(struct Parallax*, float view_x, float view_y, int w, int h);
+
+#endif // PARALLAX_H_INCLUDED
@@ -1,14 +1,18 @@
 #include <allegro5/allegro.h>
 #include "player.h"
 #include "game.h"
+#include "tilemap.h"
+#include "collision.h"
+#include "atlas.h"
+#include "profile.h"
+#include "latency.h"
 #include "states/gamestate.h"
 #include "states/deadstate.h"
 
-#include "data/sprites.h"
-
 struct Player
 {
     float x, y;
+    float last_x, last_y; // Before the last update, to draw in between
     float yspeed;
     int dir;
 
@@ -22,58 +26,64 @@ struct Player
     sprite;
 
     struct Keys* keys;
-};
 
-int go_down = 0;
+    // What Luna ran into on the last update
+    struct Contact contact;
 
-// Checks for a tile using the player's position and width/height
-static struct Tile* check_tile(struct Player* p, float x, float y)
-{
-    int i;
-    struct Tile* t = NULL;
+    // Facing and walking on the last update
+    int moving;
+};
 
-    for (i=0; i<vtile_count; ++i)
-    {
-        if (check_bb_collision((p->x + 15) + x, (p->y + 20) + y,
-            22, 23, vtiles[i]->x, vtiles[i]->y, vtiles[i]->w, vtiles[i]->h))
-        {
-            t = vtiles[i];
-        }
-    }
+int go_down = 0;
 
-    return t;
-}
+// Collision box, relative to the sprite
+#define BOX_X   15
+#define BOX_Y   20
+#define BOX_W   22
+#define BOX_H   23
 
 struct Player* create_player(float x, float y, struct Keys* keys)
 {
     struct Player* p = malloc(sizeof(struct Player));
 
-    p->sprite.stand = bitmap_from_data(stand_tga_data, stand_tga_length, ".tga");
-    p->sprite.walk = bitmap_from_data(trotting_tga_data, trotting_tga_length, ".tga");
-    p->sprite.flying = bitmap_from_data(flying_tga_data, flying_tga_length, ".tga");
+    // Owned by the atlas
+    p->sprite.stand = atlas_get(ATLAS_STAND);
+    p->sprite.walk = atlas_get(ATLAS_TROTTING);
+    p->sprite.flying = atlas_get(ATLAS_FLYING);
     p->sprite.frame = 0;
 
     p->keys = keys;
 
     p->x = x;
     p->y = y;
+    p->last_x = x;
+    p->last_y = y;
     p->yspeed = 0;
     p->dir = 1;
 
+    p->contact.grounded = 0;
+    p->contact.ceiling = 0;
+    p->contact.wall_left = 0;
+    p->contact.wall_right = 0;
+
+    p->moving = 0;
+
     return p;
 }
 
 void destroy_player(struct Player* p)
 {
-    al_destroy_bitmap(p->sprite.stand);
-    al_destroy_bitmap(p->sprite.walk);
-    al_destroy_bitmap(p->sprite.flying);
-
     free(p);
 }
 
 void player_update(struct Player* p)
 {
+    float dx = 0, x, y;
+    int moving, jumped = 0;
+
+    p->last_x = p->x;
+    p->last_y = p->y;
+
     // Moving...
     if (p->keys->left)
     {
@@ -81,12 +91,7 @@ void player_update(struct Player* p)
 
         if (p->y < 480)
         {
-            p->x -= p->keys->run ? 6 : 3;
-        }
-
-        while (check_tile(p, 0, 0))
-        {
-            ++p->x;
+            dx = (p->keys->run ? -6 : -3) * p->keys->left_held;
         }
     }
     else if (p->keys->right)
@@ -95,19 +100,30 @@ void player_update(struct Player* p)
 
         if (p->y < 480)
         {
-            p->x += p->keys->run ? 6 : 3;
-        }
-
-        while (check_tile(p, 0, 0))
-        {
-            --p->x;
+            dx = (p->keys->run ? 6 : 3) * p->keys->right_held;
         }
     }
 
     // Only jump if Luna is standing on ground
-    if (p->keys->jump && check_tile(p, 0, 1))
+    if (p->keys->jump && p->contact.grounded)
     {
         p->yspeed = -12;
+        jumped = 1;
+    }
+
+    // Where key presses show: a change in facing or walking for the arrows,
+    // a jump starting for Up
+    moving = p->dir | (dx < 0) << 1 | (dx > 0) << 2;
+
+    if (moving != p->moving)
+    {
+        latency_reaction(LATENCY_KEY_MOVE, al_get_time());
+        p->moving = moving;
+    }
+
+    if (jumped)
+    {
+        latency_reaction(LATENCY_KEY_JUMP, al_get_time());
     }
 
     // Update vertical speed
@@ -117,21 +133,17 @@ void player_update(struct Player* p)
         p->yspeed = 12;
     }
 
-    p->y += p->yspeed;
+    // Move, stopping Luna right where she touches the tiles
+    x = p->x + BOX_X;
+    y = p->y + BOX_Y;
 
-    // Stop Luna when overlapping with tiles
-    struct Tile* t = check_tile(p, 0, 0);
-    if (t)
-    {
-        if (p->yspeed > 0)
-        {
-            p->y = t->y - 43;
-        }
-        else if (p->yspeed < 0)
-        {
-            p->y = t->y + t->h - 20;
-        }
+    move_box(colliders, &x, &y, BOX_W, BOX_H, dx, p->yspeed, &p->contact);
+
+    p->x = x - BOX_X;
+    p->y = y - BOX_Y;
 
+    if (p->contact.grounded || p->contact.ceiling)
+    {
         p->yspeed = 0;
     }
 
@@ -153,26 +165,38 @@ void player_update(struct Player* p)
 
 void player_draw(struct Player* p)
 {
+    float t = get_interpolation();
+    float x = p->last_x + (p->x - p->last_x) * t - view_x;
+    float y = p->last_y + (p->y - p->last_y) * t - view_y;
+
     // On ground
-    if (check_tile(p, 0, 1))
+    if (p->contact.grounded)
     {
         if (p->keys->left || p->keys->right)
         {
             al_draw_bitmap_region(p->sprite.walk, p->sprite.frame * 48,
-                0, 48, 47, p->x - view_x, p->y - 4 - view_y,
+                0, 48, 47, x, y - 4,
                 p->dir == 1 ? 0 : ALLEGRO_FLIP_HORIZONTAL);
+
+            profile_count_blit(p->sprite.walk, x, y - 4, 48, 47);
         }
         else
         {
-            al_draw_bitmap(p->sprite.stand, p->x - view_x, p->y - view_y,
+            al_draw_bitmap(p->sprite.stand, x, y,
             p->dir == 1 ? 0 : ALLEGRO_FLIP_HORIZONTAL);
+
+            profile_count_blit(p->sprite.stand, x, y,
+                al_get_bitmap_width(p->sprite.stand),
+                al_get_bitmap_height(p->sprite.stand));
         }
     }
     else // Flying or falling
     {
         al_draw_bitmap_region(p->sprite.flying, p->sprite.frame * 48,
-            0, 48, 56, p->x - view_x, p->y - 4 - view_y,
+            0, 48, 56, x, y - 4,
             p->dir == 1 ? 0 : ALLEGRO_FLIP_HORIZONTAL);
+
+        profile_count_blit(p->sprite.flying, x, y - 4, 48, 56);
     }
 }
 
@@ -9,6 +9,11 @@ struct Keys
     int right;
     int run;
     int jump;
+
+    // Part of the tick left and right were down, from 0 to 1 (only less
+    // than a whole tick with the input thread, see input.h)
+    float left_held;
+    float right_held;
 };
 
 struct Player* create_player(float x, float y, struct Keys*);
@@ -0,0 +1,418 @@
+// Per-frame timing of the phases of the main loop
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <allegro5/allegro.h>
+#include <allegro5/allegro_primitives.h>
+#include "profile.h"
+#include "trace.h"
+#include "game.h"
+
+// Work done in a frame (every phase added up), shown after the phases
+#define FRAME       PHASE_COUNT
+#define SERIES      (PHASE_COUNT + 1)
+
+static const char* phase_names[SERIES] =
+{
+    "events",
+    "update",
+    "draw",
+    "blit",
+    "flip",
+    "frame"
+};
+
+static const char* stat_names[STAT_COUNT] =
+{
+    "draw_calls",
+    "texture_switches",
+    "tiles_drawn",
+    "tiles_total",
+    "pixels",
+    "updates",
+    "dropped"
+};
+
+static struct
+{
+    // When each phase started, and how long it took so far this frame
+    double start[PHASE_COUNT];
+    double time[PHASE_COUNT];
+
+    int frame;
+    FILE* csv;
+
+    // Counters for this frame and the last one, and the texture in use
+    int stats[STAT_COUNT];
+    int last_stats[STAT_COUNT];
+    ALLEGRO_BITMAP* texture;
+    int area;
+    FILE* stats_csv;
+
+    // Updates dropped since the start
+    int dropped;
+
+    // Last frames (in ms), as a ring starting at frame % PROFILE_HISTORY
+    float history[SERIES][PROFILE_HISTORY];
+
+    // Every frame so far
+    unsigned int histogram[SERIES][PROFILE_BUCKETS];
+    const char* histogram_file;
+
+    int overlay;
+}
+profile;
+
+// Every phase is also a span in the trace
+void profile_begin(int phase)
+{
+    trace_begin(phase_names[phase]);
+    profile.start[phase] = al_get_time();
+}
+
+void profile_end(int phase)
+{
+    profile.time[phase] += al_get_time() - profile.start[phase];
+    trace_end(phase_names[phase]);
+}
+
+static void add_sample(int series, double ms)
+{
+    int bucket = ms / PROFILE_BUCKET;
+
+    if (bucket >= PROFILE_BUCKETS)
+    {
+        bucket = PROFILE_BUCKETS - 1;
+    }
+
+    profile.history[series][profile.frame % PROFILE_HISTORY] = ms;
+    ++profile.histogram[series][bucket];
+}
+
+static void count_draw(ALLEGRO_BITMAP* texture)
+{
+    ALLEGRO_BITMAP* target = al_get_target_bitmap();
+
+    // Sub-bitmaps share the texture of their parent
+    if (texture != NULL && al_get_parent_bitmap(texture) != NULL)
+    {
+        texture = al_get_parent_bitmap(texture);
+    }
+
+    if (texture != NULL && texture != profile.texture)
+    {
+        ++profile.stats[STAT_TEXTURE_SWITCHES];
+        profile.texture = texture;
+    }
+
+    ++profile.stats[STAT_DRAW_CALLS];
+    profile.area = al_get_bitmap_width(target) * al_get_bitmap_height(target);
+}
+
+void profile_count_blit(ALLEGRO_BITMAP* texture, float x, float y, float w,
+  float h)
+{
+    ALLEGRO_BITMAP* target = al_get_target_bitmap();
+    float x2 = x + w, y2 = y + h;
+    float tw = al_get_bitmap_width(target), th = al_get_bitmap_height(target);
+
+    count_draw(texture);
+
+    x = (x < 0 ? 0 : x);
+    y = (y < 0 ? 0 : y);
+    x2 = (x2 > tw ? tw : x2);
+    y2 = (y2 > th ? th : y2);
+
+    if (x < x2 && y < y2)
+    {
+        profile.stats[STAT_PIXELS] += (x2 - x) * (y2 - y);
+    }
+}
+
+void profile_count_prim(ALLEGRO_BITMAP* texture, float pixels)
+{
+    count_draw(texture);
+    profile.stats[STAT_PIXELS] += pixels;
+}
+
+void profile_count(int stat, int n)
+{
+    profile.stats[stat] += n;
+}
+
+static void write_stats()
+{
+    int i;
+
+    fprintf(profile.stats_csv, "%d", profile.frame);
+
+    for (i=0; i<STAT_COUNT; ++i)
+    {
+        fprintf(profile.stats_csv, ",%d", profile.stats[i]);
+    }
+
+    fprintf(profile.stats_csv, ",%.3f\n", profile.area > 0
+        ? profile.stats[STAT_PIXELS] / (double) profile.area : 0);
+}
+
+void profile_frame()
+{
+    int i;
+    double total = 0;
+
+    if (profile.stats_csv != NULL)
+    {
+        write_stats();
+    }
+
+    profile.dropped += profile.stats[STAT_DROPPED];
+
+    for (i=0; i<STAT_COUNT; ++i)
+    {
+        profile.last_stats[i] = profile.stats[i];
+        profile.stats[i] = 0;
+    }
+
+    profile.texture = NULL;
+
+    if (profile.csv != NULL)
+    {
+        fprintf(profile.csv, "%d", profile.frame);
+    }
+
+    for (i=0; i<PHASE_COUNT; ++i)
+    {
+        double ms = profile.time[i] * 1000;
+
+        if (profile.csv != NULL)
+        {
+            fprintf(profile.csv, ",%.4f", ms);
+        }
+
+        add_sample(i, ms);
+        total += ms;
+        profile.time[i] = 0;
+    }
+
+    add_sample(FRAME, total);
+
+    if (profile.csv != NULL)
+    {
+        fputc('\n', profile.csv);
+    }
+
+    ++profile.frame;
+}
+
+int profile_open_csv(const char* filename)
+{
+    int i;
+
+    if (profile.csv != NULL)
+    {
+        fclose(profile.csv);
+    }
+
+    profile.csv = fopen(filename, "w");
+
+    if (profile.csv == NULL)
+    {
+        printf("ERROR: Could not write timings to %s\n", filename);
+        return 0;
+    }
+
+    fputs("frame", profile.csv);
+
+    for (i=0; i<PHASE_COUNT; ++i)
+    {
+        fprintf(profile.csv, ",%s", phase_names[i]);
+    }
+
+    fputc('\n', profile.csv);
+
+    return 1;
+}
+
+int profile_open_stats_csv(const char* filename)
+{
+    int i;
+
+    profile.stats_csv = fopen(filename, "w");
+
+    if (profile.stats_csv == NULL)
+    {
+        printf("ERROR: Could not write render stats to %s\n", filename);
+        return 0;
+    }
+
+    fputs("frame", profile.stats_csv);
+
+    for (i=0; i<STAT_COUNT; ++i)
+    {
+        fprintf(profile.stats_csv, ",%s", stat_names[i]);
+    }
+
+    fputs(",overdraw\n", profile.stats_csv);
+
+    return 1;
+}
+
+void profile_set_histogram(const char* filename)
+{
+    profile.histogram_file = filename;
+}
+
+static void write_histogram()
+{
+    int i, j;
+    FILE* f = fopen(profile.histogram_file, "w");
+
+    if (f == NULL)
+    {
+        printf("ERROR: Could not write histogram to %s\n",
+            profile.histogram_file);
+        return;
+    }
+
+    fputs("ms", f);
+
+    for (i=0; i<SERIES; ++i)
+    {
+        fprintf(f, ",%s", phase_names[i]);
+    }
+
+    fputc('\n', f);
+
+    // Lower end of every bucket, skipping the empty ones
+    for (j=0; j<PROFILE_BUCKETS; ++j)
+    {
+        int used = 0;
+
+        for (i=0; i<SERIES; ++i)
+        {
+            used |= (profile.histogram[i][j] != 0);
+        }
+
+        if (!used)
+        {
+            continue;
+        }
+
+        fprintf(f, "%.1f", j * PROFILE_BUCKET);
+
+        for (i=0; i<SERIES; ++i)
+        {
+            fprintf(f, ",%u", profile.histogram[i][j]);
+        }
+
+        fputc('\n', f);
+    }
+
+    fclose(f);
+}
+
+void profile_close()
+{
+    if (profile.csv != NULL)
+    {
+        fclose(profile.csv);
+        profile.csv = NULL;
+    }
+
+    if (profile.stats_csv != NULL)
+    {
+        fclose(profile.stats_csv);
+        profile.stats_csv = NULL;
+    }
+
+    if (profile.histogram_file != NULL)
+    {
+        write_histogram();
+        profile.histogram_file = NULL;
+    }
+
+    if (profile.dropped > 0)
+    {
+        printf("WARNING: %d updates (%.2f s of game time) were dropped to "
+            "catch up\n", profile.dropped,
+            profile.dropped / (double) game_config->framerate);
+    }
+}
+
+void profile_toggle_overlay()
+{
+    profile.overlay = !profile.overlay;
+}
+
+static int compare_float(const void* a, const void* b)
+{
+    float d = *(const float*) a - *(const float*) b;
+    return (d > 0) - (d < 0);
+}
+
+void profile_draw_overlay(float x, float y, double budget)
+{
+    int i, j;
+    int count = (profile.frame < PROFILE_HISTORY ? profile.frame
+        : PROFILE_HISTORY);
+    float sorted[PROFILE_HISTORY];
+    float budget_ms = budget * 1000;
+    float graph_y = y + (SERIES + 4) * 10 + 4;
+    ALLEGRO_COLOR text = al_map_rgb(255, 255, 255);
+
+    if (!profile.overlay || count == 0)
+    {
+        return;
+    }
+
+    al_draw_filled_rectangle(x, y, x + PROFILE_HISTORY + 8, graph_y + 44,
+        al_map_rgba(0, 0, 0, 192));
+
+    al_draw_text(font, text, x + 4, y + 4, 0,
+        "ms       p50    p95    p99");
+
+    for (i=0; i<SERIES; ++i)
+    {
+        memcpy(sorted, profile.history[i], sizeof(float) * count);
+        qsort(sorted, count, sizeof(float), compare_float);
+
+        al_draw_textf(font, text, x + 4, y + 14 + i * 10, 0,
+            "%-6s %6.2f %6.2f %6.2f", phase_names[i], sorted[count / 2],
+            sorted[(count * 95 + 99) / 100 - 1],
+            sorted[(count * 99 + 99) / 100 - 1]);
+    }
+
+    al_draw_textf(font, text, x + 4, y + 14 + SERIES * 10, 0,
+        "calls %d, textures %d", profile.last_stats[STAT_DRAW_CALLS],
+        profile.last_stats[STAT_TEXTURE_SWITCHES]);
+
+    al_draw_textf(font, text, x + 4, y + 24 + SERIES * 10, 0,
+        "tiles %d/%d, overdraw %.2f", profile.last_stats[STAT_TILES_DRAWN],
+        profile.last_stats[STAT_TILES_TOTAL], profile.area > 0
+        ? profile.last_stats[STAT_PIXELS] / (double) profile.area : 0);
+
+    al_draw_textf(font, text, x + 4, y + 34 + SERIES * 10, 0,
+        "updates %d, dropped %d (%.2f s)", profile.last_stats[STAT_UPDATES],
+        profile.dropped, profile.dropped / (double) game_config->framerate);
+
+    // Work per frame, oldest on the left; the line is the frame budget
+    for (j=0; j<count; ++j)
+    {
+        int frame = profile.frame - count + j;
+        float ms = profile.history[FRAME][frame % PROFILE_HISTORY];
+        float h = (ms / budget_ms) * 30;
+
+        if (h > 40)
+        {
+            h = 40;
+        }
+
+        al_draw_line(x + 4 + j + 0.5, graph_y + 40, x + 4 + j + 0.5,
+            graph_y + 40 - h, ms > budget_ms ? al_map_rgb(255, 64, 64)
+            : al_map_rgb(64, 255, 64), 1);
+    }
+
+    al_draw_line(x + 4, graph_y + 10, x + 4 + PROFILE_HISTORY, graph_y + 10,
+        al_map_rgb(255, 255, 0), 1);
+}
@@ -0,0 +1,71 @@
+#ifndef PROFILE_H_INCLUDED
+#define PROFILE_H_INCLUDED
+
+#include <allegro5/allegro.h>
+
+// Parts of a frame in game_run()
+enum
+{
+    PHASE_EVENTS,   // Passing events to the state
+    PHASE_UPDATE,
+    PHASE_DRAW,
+    PHASE_BLIT,     // Copying the buffer to the screen
+    PHASE_FLIP,
+    PHASE_COUNT
+};
+
+// Things counted in a frame
+enum
+{
+    STAT_DRAW_CALLS,
+    STAT_TEXTURE_SWITCHES,
+    STAT_TILES_DRAWN,
+    STAT_TILES_TOTAL,
+    STAT_PIXELS,        // Every pixel drawn, so pixels / screen is the overdraw
+    STAT_UPDATES,       // Updates run before drawing the frame
+    STAT_DROPPED,       // Updates let go of to catch up after a slow frame
+    STAT_COUNT
+};
+
+// Frames kept for the overlay (percentiles and graph)
+#define PROFILE_HISTORY     240
+
+// Histogram buckets (in ms), anything slower goes in the last one
+#define PROFILE_BUCKET      0.1
+#define PROFILE_BUCKETS     500
+
+// Times a phase; a phase can run several times in a frame (e.g. two updates),
+// and then its times are added up
+void profile_begin(int phase);
+void profile_end(int phase);
+
+// Counts a bitmap drawn at x, y (only the part inside the target counts as
+// filled), or a call drawing 'pixels' pixels; texture is NULL if untextured
+void profile_count_blit(ALLEGRO_BITMAP* texture, float x, float y, float w,
+    float h);
+void profile_count_prim(ALLEGRO_BITMAP* texture, float pixels);
+
+void profile_count(int stat, int n);
+
+// Closes the current frame, writing it to the CSV file (if any)
+void profile_frame();
+
+// Writes every frame to a CSV file, with the time of each phase in ms
+int profile_open_csv(const char* filename);
+
+// Writes the counters of every frame to a CSV file
+int profile_open_stats_csv(const char* filename);
+
+// Writes a histogram of every phase to a CSV file when closing
+void profile_set_histogram(const char* filename);
+
+// Closes the CSV files and writes the histogram (and says how many updates
+// were dropped, if any)
+void profile_close();
+
+// Percentiles of the last PROFILE_HISTORY frames and a graph of them, for
+// a frame budget of 'budget' seconds
+void profile_toggle_overlay();
+void profile_draw_overlay(float x, float y, double budget);
+
+#endif // PROFILE_H_INCLUDED
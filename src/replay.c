@@ -0,0 +1,243 @@
+// Deterministic recording and playback of the per-tick keys
+
+#include <stdio.h>
+#include <string.h>
+#include <allegro5/allegro.h>
+#include "replay.h"
+#include "player.h"
+
+static struct
+{
+    ALLEGRO_FILE* file;
+    int recording;
+
+    // Current run of identical ticks
+    int keys;
+    unsigned int run;
+}
+replay =
+{
+    NULL, 0,
+    0, 0
+};
+
+// Part of a tick a key was held, in 1/255ths
+static int pack_held(int key, float held)
+{
+    if (!key || held < 0)
+    {
+        return 0;
+    }
+
+    return (held > 1 ? 255 : (int) (held * 255 + 0.5));
+}
+
+// Keys byte, and the held bytes above it when they're needed
+static int pack_keys(struct Keys* k)
+{
+    int bits = (k->left ? 1 : 0) | (k->right ? 2 : 0) | (k->run ? 4 : 0)
+        | (k->jump ? 8 : 0);
+    int left = pack_held(k->left, k->left_held);
+    int right = pack_held(k->right, k->right_held);
+
+    if (left != (k->left ? 255 : 0) || right != (k->right ? 255 : 0))
+    {
+        bits |= 16 | (left << 8) | (right << 16);
+    }
+
+    return bits;
+}
+
+static void unpack_keys(int bits, struct Keys* k)
+{
+    k->left = (bits & 1) != 0;
+    k->right = (bits & 2) != 0;
+    k->run = (bits & 4) != 0;
+    k->jump = (bits & 8) != 0;
+
+    if (bits & 16)
+    {
+        k->left_held = ((bits >> 8) & 255) / 255.0;
+        k->right_held = ((bits >> 16) & 255) / 255.0;
+    }
+    else
+    {
+        k->left_held = k->left;
+        k->right_held = k->right;
+    }
+}
+
+static void write_run()
+{
+    unsigned int n = replay.run;
+
+    al_fputc(replay.file, replay.keys & 255);
+
+    if (replay.keys & 16)
+    {
+        al_fputc(replay.file, (replay.keys >> 8) & 255);
+        al_fputc(replay.file, (replay.keys >> 16) & 255);
+    }
+
+    while (n >= 0x80)
+    {
+        al_fputc(replay.file, (n & 0x7F) | 0x80);
+        n >>= 7;
+    }
+
+    al_fputc(replay.file, n);
+}
+
+// Returns 0 at the end of the file
+static int read_run()
+{
+    int c, shift = 0;
+
+    replay.keys = al_fgetc(replay.file);
+    replay.run = 0;
+
+    if (replay.keys == EOF)
+    {
+        return 0;
+    }
+
+    if (replay.keys & 16)
+    {
+        int left = al_fgetc(replay.file);
+        int right = al_fgetc(replay.file);
+
+        if (left == EOF || right == EOF)
+        {
+            return 0;
+        }
+
+        replay.keys |= (left << 8) | (right << 16);
+    }
+
+    do
+    {
+        c = al_fgetc(replay.file);
+
+        if (c == EOF)
+        {
+            return 0;
+        }
+
+        replay.run |= (unsigned int) (c & 0x7F) << shift;
+        shift += 7;
+    }
+    while (c & 0x80);
+
+    return replay.run > 0;
+}
+
+int replay_record(const char* filename, unsigned int seed)
+{
+    replay_close();
+
+    replay.file = al_fopen(filename, "wb");
+
+    if (replay.file == NULL)
+    {
+        printf("ERROR: Could not write replay %s\n", filename);
+        return 0;
+    }
+
+    al_fwrite(replay.file, "LRP2", 4);
+    al_fwrite32le(replay.file, seed);
+
+    replay.recording = 1;
+    replay.keys = 0;
+    replay.run = 0;
+
+    return 1;
+}
+
+int replay_play(const char* filename, unsigned int* seed)
+{
+    char magic[4];
+
+    replay_close();
+
+    replay.file = al_fopen(filename, "rb");
+
+    if (replay.file == NULL)
+    {
+        printf("ERROR: Could not open replay %s\n", filename);
+        return 0;
+    }
+
+    if (al_fread(replay.file, magic, 4) != 4 || (memcmp(magic, "LRP1", 4) != 0
+        && memcmp(magic, "LRP2", 4) != 0))
+    {
+        printf("ERROR: %s is not a replay\n", filename);
+        al_fclose(replay.file);
+        replay.file = NULL;
+        return 0;
+    }
+
+    *seed = al_fread32le(replay.file);
+
+    replay.recording = 0;
+    replay.run = 0;
+
+    return 1;
+}
+
+int replay_is_playing()
+{
+    return replay.file != NULL && !replay.recording;
+}
+
+int replay_tick(struct Keys* keys)
+{
+    if (replay.file == NULL)
+    {
+        return 1;
+    }
+
+    if (replay.recording)
+    {
+        int bits = pack_keys(keys);
+
+        if (replay.run > 0 && bits != replay.keys)
+        {
+            write_run();
+            replay.run = 0;
+        }
+
+        replay.keys = bits;
+        ++replay.run;
+
+        // Rounded as saved
+        unpack_keys(bits, keys);
+
+        return 1;
+    }
+
+    if (replay.run == 0 && !read_run())
+    {
+        return 0;
+    }
+
+    unpack_keys(replay.keys, keys);
+    --replay.run;
+
+    return 1;
+}
+
+void replay_close()
+{
+    if (replay.file == NULL)
+    {
+        return;
+    }
+
+    if (replay.recording && replay.run > 0)
+    {
+        write_run();
+    }
+
+    al_fclose(replay.file);
+    replay.file = NULL;
+}
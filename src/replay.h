@@ -0,0 +1,27 @@
+#ifndef REPLAY_H_INCLUDED
+#define REPLAY_H_INCLUDED
+
+struct Keys;
+
+// Replay files: "LRP2", the RNG seed (32-bit little-endian), then runs of
+// identical ticks as a keys byte (bit 0 left, 1 right, 2 run, 3 jump),
+// if bit 4 is set the part of the tick left and right were held (a byte
+// each, in 1/255ths), then the run length (7 bits per byte, high bit = more
+// bytes). "LRP1" files are the same, without bit 4
+
+// Start recording, or start playing back (which gives the seed to use)
+int replay_record(const char* filename, unsigned int seed);
+int replay_play(const char* filename, unsigned int* seed);
+
+int replay_is_playing();
+
+// Called once per tick with the keys used for it: they're saved when
+// recording (rounding left_held and right_held as they're saved, so the
+// game plays the same as the replay will), or replaced when playing back
+// Returns 0 once a playback is over
+int replay_tick(struct Keys*);
+
+// Stops recording (writing what's left) or playing back
+void replay_close();
+
+#endif // REPLAY_H_INCLUDED
@@ -0,0 +1,276 @@
+// Spatial hash for objects of any size placed freely in the world
+
+#include <stdlib.h>
+#include <math.h>
+#include "spatial.h"
+#include "game.h"
+
+struct Object
+{
+    void* data;
+    float x, y, w, h;
+
+    // Cells it's linked to
+    int cx1, cy1, cx2, cy2;
+
+    // Last query that returned it (so it's only returned once)
+    int stamp;
+
+    // -1 if alive, otherwise the next free object
+    int next_free;
+};
+
+struct Node
+{
+    int object;
+    int cx, cy;
+    int next;
+};
+
+struct Spatial
+{
+    int buckets[SPATIAL_BUCKETS];
+
+    struct Object* objects;
+    int object_count, object_max;
+    int free_object;
+
+    struct Node* nodes;
+    int node_max;
+    int free_node;
+
+    int stamp;
+};
+
+static unsigned int hash_cell(int cx, int cy)
+{
+    return ((unsigned int) cx * 73856093u ^ (unsigned int) cy * 19349663u)
+        & (SPATIAL_BUCKETS - 1);
+}
+
+static void get_cells(float x, float y, float w, float h,
+  int* cx1, int* cy1, int* cx2, int* cy2)
+{
+    *cx1 = floor(x / SPATIAL_CELL);
+    *cy1 = floor(y / SPATIAL_CELL);
+    *cx2 = floor((x + w) / SPATIAL_CELL);
+    *cy2 = floor((y + h) / SPATIAL_CELL);
+}
+
+struct Spatial* create_spatial()
+{
+    int i;
+    struct Spatial* s = malloc(sizeof(struct Spatial));
+
+    for (i=0; i<SPATIAL_BUCKETS; ++i)
+    {
+        s->buckets[i] = -1;
+    }
+
+    s->objects = NULL;
+    s->object_count = s->object_max = 0;
+    s->free_object = -1;
+
+    s->nodes = NULL;
+    s->node_max = 0;
+    s->free_node = -1;
+
+    s->stamp = 0;
+
+    return s;
+}
+
+void destroy_spatial(struct Spatial* s)
+{
+    free(s->objects);
+    free(s->nodes);
+    free(s);
+}
+
+static void link_object(struct Spatial* s, int handle)
+{
+    int cx, cy;
+    struct Object* o = &s->objects[handle];
+
+    for (cx=o->cx1; cx<=o->cx2; ++cx)
+    {
+        for (cy=o->cy1; cy<=o->cy2; ++cy)
+        {
+            unsigned int b = hash_cell(cx, cy);
+            int n;
+
+            if (s->free_node < 0)
+            {
+                // Grow the pool, chaining the new nodes as free
+                int i, old = s->node_max;
+
+                s->node_max = (old ? old * 2 : 64);
+                s->nodes = realloc(s->nodes, sizeof(struct Node) * s->node_max);
+
+                for (i=old; i<s->node_max; ++i)
+                {
+                    s->nodes[i].next = (i + 1 < s->node_max ? i + 1 : -1);
+                }
+
+                s->free_node = old;
+            }
+
+            n = s->free_node;
+            s->free_node = s->nodes[n].next;
+
+            s->nodes[n].object = handle;
+            s->nodes[n].cx = cx;
+            s->nodes[n].cy = cy;
+            s->nodes[n].next = s->buckets[b];
+            s->buckets[b] = n;
+        }
+    }
+}
+
+static void unlink_object(struct Spatial* s, int handle)
+{
+    int cx, cy;
+    struct Object* o = &s->objects[handle];
+
+    for (cx=o->cx1; cx<=o->cx2; ++cx)
+    {
+        for (cy=o->cy1; cy<=o->cy2; ++cy)
+        {
+            int* link = &s->buckets[hash_cell(cx, cy)];
+
+            while (*link >= 0)
+            {
+                struct Node* n = &s->nodes[*link];
+
+                if (n->object == handle && n->cx == cx && n->cy == cy)
+                {
+                    int freed = *link;
+
+                    *link = n->next;
+                    n->next = s->free_node;
+                    s->free_node = freed;
+                    break;
+                }
+
+                link = &n->next;
+            }
+        }
+    }
+}
+
+int spatial_insert(struct Spatial* s, void* data, float x, float y,
+  float w, float h)
+{
+    int handle;
+    struct Object* o;
+
+    if (s->free_object >= 0)
+    {
+        handle = s->free_object;
+        s->free_object = s->objects[handle].next_free;
+    }
+    else
+    {
+        if (s->object_count == s->object_max)
+        {
+            s->object_max = (s->object_max ? s->object_max * 2 : 16);
+            s->objects = realloc(s->objects,
+                sizeof(struct Object) * s->object_max);
+        }
+
+        handle = s->object_count++;
+    }
+
+    o = &s->objects[handle];
+    o->data = data;
+    o->x = x;
+    o->y = y;
+    o->w = w;
+    o->h = h;
+    o->stamp = 0;
+    o->next_free = -1;
+
+    get_cells(x, y, w, h, &o->cx1, &o->cy1, &o->cx2, &o->cy2);
+    link_object(s, handle);
+
+    return handle;
+}
+
+void spatial_move(struct Spatial* s, int handle, float x, float y,
+  float w, float h)
+{
+    int cx1, cy1, cx2, cy2;
+    struct Object* o = &s->objects[handle];
+
+    get_cells(x, y, w, h, &cx1, &cy1, &cx2, &cy2);
+
+    // Only relink when it touches different cells
+    if (cx1 != o->cx1 || cy1 != o->cy1 || cx2 != o->cx2 || cy2 != o->cy2)
+    {
+        unlink_object(s, handle);
+
+        o->cx1 = cx1;
+        o->cy1 = cy1;
+        o->cx2 = cx2;
+        o->cy2 = cy2;
+
+        link_object(s, handle);
+    }
+
+    o->x = x;
+    o->y = y;
+    o->w = w;
+    o->h = h;
+}
+
+void spatial_remove(struct Spatial* s, int handle)
+{
+    unlink_object(s, handle);
+
+    s->objects[handle].next_free = s->free_object;
+    s->free_object = handle;
+}
+
+int spatial_query(struct Spatial* s, float x, float y, float w, float h,
+  void** found, int max)
+{
+    int cx, cy, cx1, cy1, cx2, cy2;
+    int count = 0;
+
+    get_cells(x, y, w, h, &cx1, &cy1, &cx2, &cy2);
+    ++s->stamp;
+
+    for (cx=cx1; cx<=cx2; ++cx)
+    {
+        for (cy=cy1; cy<=cy2; ++cy)
+        {
+            int n;
+
+            for (n=s->buckets[hash_cell(cx, cy)]; n>=0; n=s->nodes[n].next)
+            {
+                struct Object* o = &s->objects[s->nodes[n].object];
+
+                // Other cells can share the bucket
+                if (s->nodes[n].cx != cx || s->nodes[n].cy != cy
+                    || o->stamp == s->stamp)
+                {
+                    continue;
+                }
+
+                o->stamp = s->stamp;
+
+                if (check_bb_collision(x, y, w, h, o->x, o->y, o->w, o->h))
+                {
+                    if (count == max)
+                    {
+                        return count;
+                    }
+
+                    found[count++] = o->data;
+                }
+            }
+        }
+    }
+
+    return count;
+}
@@ -0,0 +1,29 @@
+#ifndef SPATIAL_H_INCLUDED
+#define SPATIAL_H_INCLUDED
+
+// Size of every cell of the hash (in pixels)
+#define SPATIAL_CELL    256
+
+// Number of buckets (power of two)
+#define SPATIAL_BUCKETS 1024
+
+// Uniform grid hashed by cell, for things placed anywhere in the world
+// (an object is linked to every cell it touches)
+struct Spatial;
+
+struct Spatial* create_spatial();
+void destroy_spatial(struct Spatial*);
+
+// Returns a handle for the object
+int spatial_insert(struct Spatial*, void* data, float x, float y,
+    float w, float h);
+void spatial_move(struct Spatial*, int handle, float x, float y,
+    float w, float h);
+void spatial_remove(struct Spatial*, int handle);
+
+// Fills "found" with the objects overlapping a rectangle (each one once)
+// Returns how many were found, up to max
+int spatial_query(struct Spatial*, float x, float y, float w, float h,
+    void** found, int max);
+
+#endif // SPATIAL_H_INCLUDED
@@ -19,7 +19,13 @@ static void on_init(void* param)
 {
     data.dead = bitmap_from_data(dead_tga_data, dead_tga_length, ".tga");
 
-    data.music = al_load_audio_stream("youdied.ogg", 2, 4086);
+    data.music = NULL;
+
+    if (game_config->audio)
+    {
+        data.music = al_load_audio_stream("youdied.ogg", 2, 4086);
+    }
+
     if (data.music != NULL)
     {
         al_attach_audio_stream_to_mixer(data.music, al_get_default_mixer());
@@ -60,7 +66,12 @@ static void on_update()
     }
     else
     {
-        al_rest(25.0);
+        // Nobody's watching when running headless
+        if (!game_config->headless)
+        {
+            al_rest(25.0);
+        }
+
         game_over();
     }
 }
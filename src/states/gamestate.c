@@ -4,12 +4,23 @@
 #include <stdlib.h>
 #include <time.h>
 #include <string.h>
+#include <math.h>
 #include <allegro5/allegro.h>
 #include <allegro5/allegro_audio.h>
 #include <allegro5/allegro_primitives.h>
 #include <allegro5/allegro_memfile.h>
 #include "../game.h"
 #include "../player.h"
+#include "../tilemap.h"
+#include "../collision.h"
+#include "../tilecache.h"
+#include "../tilemesh.h"
+#include "../atlas.h"
+#include "../spatial.h"
+#include "../replay.h"
+#include "../input.h"
+#include "../profile.h"
+#include "../parallax.h"
 #include "gamestate.h"
 #include "scarestate.h"
 #include "deadstate.h"
@@ -18,21 +29,64 @@
 #include "../data/music.h"
 #include "../data/level.h"
 
-struct Tile* vtiles[500];
-int vtile_count = 0;
+struct Tilemap* level;
+struct Colliders* colliders;
 
 float view_x = 0;
 float view_y = 0;
 
 // Structure holding default player keys
-static struct Keys default_keys = { 0, 0, 0, 0 };
+static struct Keys default_keys = { 0, 0, 0, 0, 0, 0 };
 
 // Player
 static struct Player* player;
 
-// Full list of tiles
-static struct Tile* tile_list;
-static int tile_count = 0;
+// Things placed in the world other than tiles
+enum
+{
+    PROP_TEXT,
+    TRIGGER_GO_DOWN,    // Camera follows Luna down (after the scare)
+    TRIGGER_FADE        // Fade out to the end
+};
+
+struct Prop
+{
+    int type;
+    float x, y, w, h;
+};
+
+// How far down the triggers reach (the fade is over long before that)
+#define FALL_DEPTH  8192
+
+// Widths are set once the level is loaded
+static struct Prop props[] =
+{
+    { PROP_TEXT, 257, 289, 0, 0 },
+    { TRIGGER_GO_DOWN, 5556, 0, 0, FALL_DEPTH },
+    { TRIGGER_FADE, 0, 3334, 0, FALL_DEPTH - 3334 }
+};
+
+#define PROP_COUNT  (sizeof(props) / sizeof(struct Prop))
+
+// Max. props returned by a single query
+#define MAX_FOUND   16
+
+// Props, hashed by position; triggers span the whole level, which would link
+// them to every cell of the hash, so they're checked on their own
+static struct Spatial* objects;
+
+// Level geometry in vertex buffers, or pre-rendered blocks if the display
+// can't do vertex buffers (only one of them is used)
+static struct Tilemesh* mesh;
+static struct Tilecache* cache;
+
+// Background layers
+static struct Parallax* background;
+
+// Camera position on the last tick, to know where it's heading and to
+// draw in between ticks
+static float last_view_x = 0;
+static float last_view_y = 0;
 
 static struct // Data
 {
@@ -60,86 +114,161 @@ static int max_width = 0;
 // Whether we've reached 'creepy mode'
 static int creepy = 0;
 
-static void on_init(void* param)
+// Triggers the camera position is in (there are only a few of them)
+static int find_triggers(float x, float y, void** found)
 {
-    int i;
-
-    ALLEGRO_FILE* file_level = al_open_memfile(level_txt_data, level_txt_length, "r");
+    int i, count = 0;
 
-    while (!al_feof(file_level))
+    for (i=0; i<PROP_COUNT; ++i)
     {
-        int c = al_fgetc(file_level);
+        struct Prop* prop = &props[i];
 
-        if (c == '\n')
+        if (prop->type != PROP_TEXT && count < MAX_FOUND
+            && check_bb_collision(x, y, 1, 1, prop->x, prop->y, prop->w,
+            prop->h))
         {
-            ++tile_count;
+            found[count++] = prop;
         }
     }
 
-    tile_list = malloc(sizeof(struct Tile) * tile_count);
-    al_fseek(file_level, 0, ALLEGRO_SEEK_SET);
+    return count;
+}
+
+static void on_init(void* param)
+{
+    int i;
+    unsigned int seed = time(NULL);
+
+    level = NULL;
+    player = NULL;
+
+    // Every image shares one texture, so drawing can be batched
+    if (!create_atlas())
+    {
+        puts("ERROR: Could not create the texture atlas...");
+        game_over();
+        return;
+    }
+
+    if (game_config->level != NULL)
+    {
+        level = load_tilemap_file(game_config->level);
+    }
 
-    for (i=0; i<tile_count; ++i)
+    if (level == NULL)
     {
-        int v;
-        char line[100];
+        ALLEGRO_FILE* file_level = al_open_memfile(level_lvl_data, level_lvl_length, "r");
+
+        // Compiled from level.txt with tools/levelc (the level keeps the file)
+        level = load_tilemap(file_level);
+    }
 
-        al_fgets(file_level, line, 100);
+    max_width = level->cols * TILE_SIZE;
 
-        sscanf(line, "%d %d %d %d %d %f %f\n", &v,
-          &tile_list[i].left,
-          &tile_list[i].top,
-          &tile_list[i].w,
-          &tile_list[i].h,
-          &tile_list[i].x,
-          &tile_list[i].y
-        );
+    // Tiles merged into big rectangles, only used for collisions
+    colliders = create_colliders(level);
 
-        if (tile_list[i].x > max_width)
+    data.bg = atlas_get(ATLAS_BG);
+    data.tiles = atlas_get(ATLAS_TILES);
+    data.tilesred = atlas_get(ATLAS_TILESRED);
+    data.cracks = atlas_get(ATLAS_CRACKS);
+    data.text = atlas_get(ATLAS_TEXT);
+
+    props[0].w = al_get_bitmap_width(data.text);
+    props[0].h = al_get_bitmap_height(data.text);
+    props[1].w = max_width - props[1].x;
+    props[2].w = max_width;
+
+    // Levels from disk may be shorter than where the triggers start
+    if (props[1].w < 0)
+    {
+        props[1].w = 0;
+    }
+
+    objects = create_spatial();
+
+    for (i=0; i<PROP_COUNT; ++i)
+    {
+        if (props[i].type == PROP_TEXT)
         {
-            max_width = tile_list[i].x + tile_list[i].w;
+            spatial_insert(objects, &props[i], props[i].x, props[i].y,
+                props[i].w, props[i].h);
         }
     }
 
-    al_fclose(file_level);
+    // Repeated all over the screen, and only scrolls sideways
+    background = create_parallax();
+    parallax_add(background, data.bg, 0.4, 0, 0, 0, WRAP_BOTH);
 
-    data.bg = bitmap_from_data(bg_tga_data, bg_tga_length, ".tga");
-    data.tiles = bitmap_from_data(tiles_tga_data, tiles_tga_length, ".tga");
-    data.tilesred = bitmap_from_data(tilesred_tga_data, tilesred_tga_length, ".tga");
-    data.cracks = bitmap_from_data(cracks_tga_data, cracks_tga_length, ".tga");
-    data.text = bitmap_from_data(text_tga_data, text_tga_length, ".tga");
+    mesh = create_tilemesh(level);
+    cache = (mesh == NULL ? create_tilecache(level, data.cracks) : NULL);
 
-    data.fmusic = al_open_memfile(music1_ogg_data, music1_ogg_length, "r");
-    data.music = al_load_audio_stream_f(data.fmusic, ".ogg", 2, 4096);
+    data.fmusic = NULL;
+    data.music = NULL;
+    data.music2 = NULL;
 
-    al_attach_audio_stream_to_mixer(data.music, al_get_default_mixer());
-    al_set_audio_stream_playmode(data.music, ALLEGRO_PLAYMODE_LOOP);
+    // No mixer to play it on when running without audio
+    if (game_config->audio)
+    {
+        data.fmusic = al_open_memfile(music1_ogg_data, music1_ogg_length, "r");
+        data.music = al_load_audio_stream_f(data.fmusic, ".ogg", 2, 4096);
 
-    // Loop points for the music
-    al_set_audio_stream_loop_secs(data.music, 20.274,
-      al_get_audio_stream_length_secs(data.music));
+        al_attach_audio_stream_to_mixer(data.music, al_get_default_mixer());
+        al_set_audio_stream_playmode(data.music, ALLEGRO_PLAYMODE_LOOP);
 
-    srand(time(NULL));
+        // Loop points for the music
+        al_set_audio_stream_loop_secs(data.music, 20.274,
+          al_get_audio_stream_length_secs(data.music));
+    }
+
+    // A replay brings its own seed so 'rush' happens at the same time
+    if (game_config->replay != NULL)
+    {
+        if (!replay_play(game_config->replay, &seed))
+        {
+            game_over();
+        }
+    }
+    else if (game_config->record != NULL)
+    {
+        replay_record(game_config->record, seed);
+    }
+
+    srand(seed);
 
     player = create_player(100, 100, &default_keys);
 }
 
 static void on_end()
 {
-    al_destroy_bitmap(data.bg);
-    al_destroy_bitmap(data.tiles);
-    al_destroy_bitmap(data.tilesred);
-    al_destroy_bitmap(data.cracks);
-    al_destroy_bitmap(data.text);
+    // on_init() gave up before creating anything
+    if (player == NULL)
+    {
+        return;
+    }
+
+    replay_close();
 
     if (data.music2 != NULL)
     {
         al_destroy_audio_stream(data.music2);
     }
 
-    free(tile_list);
+    if (mesh != NULL)
+    {
+        destroy_tilemesh(mesh);
+    }
+    else
+    {
+        destroy_tilecache(cache);
+    }
+    destroy_parallax(background);
+    destroy_spatial(objects);
+    destroy_colliders(colliders);
+    destroy_tilemap(level);
 
     destroy_player(player);
+    destroy_atlas();
 }
 
 static void on_pause()
@@ -148,6 +277,11 @@ static void on_pause()
 
 static void on_resume()
 {
+    if (!game_config->audio)
+    {
+        return;
+    }
+
     al_set_audio_stream_playing(data.music, 0);
     al_fclose(data.fmusic);
 
@@ -162,6 +296,12 @@ static void on_resume()
 
 static void on_events(ALLEGRO_EVENT* event)
 {
+    // Keys come from the replay file, or from the input thread
+    if (replay_is_playing() || input_is_running())
+    {
+        return;
+    }
+
     if (event->type == ALLEGRO_EVENT_KEY_DOWN)
     {
         if (event->keyboard.keycode == ALLEGRO_KEY_LEFT)
@@ -218,18 +358,35 @@ static void on_events(ALLEGRO_EVENT* event)
 
 static void on_update()
 {
-    int i;
+    int i, count;
+    void* found[MAX_FOUND];
 
-    vtile_count = 0;
-
-    for (i=0; i<tile_count; ++i)
+    // Only the input thread knows when the keys changed within the tick
+    if (input_is_running())
     {
-        if (tile_list[i].x < (view_x + (SCREEN_W + tile_list[i].w))
-            && tile_list[i].x > (view_x - (tile_list[i].w * 2)))
+        input_tick(&default_keys, get_tick_time());
+
+        if (creepy)
         {
-            vtiles[vtile_count++] = &tile_list[i];
+            default_keys.run = 0;
         }
     }
+    else
+    {
+        default_keys.left_held = default_keys.left;
+        default_keys.right_held = default_keys.right;
+    }
+
+    if (!replay_tick(&default_keys))
+    {
+        puts("Replay finished");
+        game_over();
+        return;
+    }
+
+    tilemap_stream(level, view_x, SCREEN_W, view_x - last_view_x);
+    last_view_x = view_x;
+    last_view_y = view_y;
 
     if ((default_keys.left || default_keys.right) && !creepy)
     {
@@ -287,79 +444,107 @@ static void on_update()
         ++view_x;
     }
 
-    if (go_down && view_x > 5555)
+    // Triggers are checked against the camera position
+    count = find_triggers(view_x, view_y, found);
+
+    for (i=0; i<count; ++i)
     {
-        while (y > view_y + 222)
+        struct Prop* prop = found[i];
+
+        if (prop->type == TRIGGER_GO_DOWN && go_down)
         {
-            ++view_y;
+            while (y > view_y + 222)
+            {
+                ++view_y;
+            }
         }
     }
 
-    if (view_y > 3333)
+    // Again, as the camera may have just moved down
+    count = find_triggers(view_x, view_y, found);
+
+    for (i=0; i<count; ++i)
     {
-        // Fade out slowly
-        alpha += 0.01;
+        struct Prop* prop = found[i];
 
-        if (alpha >= 1.0)
+        if (prop->type == TRIGGER_FADE)
         {
-            change_state(DEAD_STATE, NULL);
+            // Fade out slowly
+            alpha += 0.01;
+
+            if (alpha >= 1.0)
+            {
+                change_state(DEAD_STATE, NULL);
+                return;
+            }
         }
     }
 }
 
 static void on_draw()
 {
-    int i, j;
+    int i, count;
+    void* found[MAX_FOUND];
+    float t = get_interpolation();
+    float tick_x = view_x, tick_y = view_y;
+
+    // Everything is drawn from where the camera was at this point between
+    // the last two ticks, on whole pixels so the tiles don't shimmer
+    view_x = floor(last_view_x + (tick_x - last_view_x) * t + 0.5);
+    view_y = floor(last_view_y + (tick_y - last_view_y) * t + 0.5);
+
+    al_hold_bitmap_drawing(1);
 
     if (!creepy)
     {
-        int w = al_get_bitmap_width(data.bg);
-        int h = al_get_bitmap_height(data.bg);
+        parallax_draw(background, view_x, view_y, SCREEN_W, SCREEN_H);
+    }
 
-        for (j=0; j<SCREEN_H; j+=w)
-        {
-            for (i=0; i<max_width; i+=h)
-            {
-                al_draw_bitmap(data.bg, i - view_x * 0.4, j, 0);
-            }
-        }
+    profile_count(STAT_TILES_TOTAL, level->tile_count);
+
+    if (mesh != NULL)
+    {
+        // Only moves texture coordinates when the look changes
+        tilemesh_set_look(mesh, creepy ? data.tilesred : data.tiles,
+            data.cracks, creepy ? 13 : crack_level);
+
+        tilemesh_draw(mesh, view_x, view_y, SCREEN_W, SCREEN_H);
+    }
+    else
+    {
+        // Blocks are baked again only when the look of the tiles changes
+        tilecache_set_look(cache, creepy ? data.tilesred : data.tiles,
+            creepy ? 13 : crack_level);
+
+        tilecache_draw(cache, view_x, view_y, SCREEN_W, SCREEN_H);
     }
 
-    for (i=0; i<vtile_count; ++i)
+    // Only props that are on-screen
+    count = spatial_query(objects, view_x, view_y, SCREEN_W, SCREEN_H,
+        found, MAX_FOUND);
+
+    for (i=0; i<count; ++i)
     {
-        al_draw_bitmap_region(creepy ? data.tilesred : data.tiles,
-            vtiles[i]->left,
-            vtiles[i]->top,
-            vtiles[i]->w,
-            vtiles[i]->h,
-            vtiles[i]->x - view_x,
-            vtiles[i]->y - view_y,
-        0);
+        struct Prop* prop = found[i];
 
-        if (creepy)
+        if (prop->type == PROP_TEXT)
         {
-            al_draw_bitmap_region(data.cracks,
-                416, 0, 32, 32,
-                vtiles[i]->x - view_x,
-                vtiles[i]->y - view_y,
-            0);
-        }
-        else
-        {
-            al_draw_bitmap_region(data.cracks,
-                crack_level * 32, 0, 32, 32,
-                vtiles[i]->x - view_x,
-                vtiles[i]->y - view_y,
-            0);
+            al_draw_bitmap(data.text, prop->x - view_x, prop->y - view_y, 0);
+            profile_count_blit(data.text, prop->x - view_x,
+                prop->y - view_y, prop->w, prop->h);
         }
     }
 
-    al_draw_bitmap(data.text, 257 - view_x, 289, 0);
-
     player_draw(player);
 
+    al_hold_bitmap_drawing(0);
+
     al_draw_filled_rectangle(0, 0, SCREEN_W, SCREEN_H,
         al_map_rgba_f(0, 0, 0, alpha));
+    profile_count_prim(NULL, SCREEN_W * SCREEN_H);
+
+    view_x = tick_x;
+    view_y = tick_y;
 }
 
 struct State* get_game_state()
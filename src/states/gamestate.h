@@ -7,23 +7,11 @@ struct State* get_game_state();
 
 #define GAME_STATE  get_game_state()
 
-struct Tile
-{
-    // Position in the tileset
-    int left, top;
+// Level grid (see tilemap.h)
+extern struct Tilemap* level;
 
-    // With and height
-    int w, h;
-
-    // Position in-game
-    float x, y;
-};
-
-// Tiles that are on-screen (not full list)
-extern struct Tile* vtiles[];
-
-// How many of them?
-extern int vtile_count;
+// Solid parts of the level (see collision.h)
+extern struct Colliders* colliders;
 
 // Camera vars
 extern float view_x;
@@ -16,7 +16,12 @@ static void on_init(void* param)
 {
     data.image = al_load_bitmap("zalgopie.png");
 
-    data.noise = al_load_sample("noise.wav");
+    data.noise = NULL;
+
+    if (game_config->audio)
+    {
+        data.noise = al_load_sample("noise.wav");
+    }
 
     if (data.noise != NULL)
     {
@@ -0,0 +1,265 @@
+// Static level geometry baked into off-screen bitmaps, so drawing the
+// level takes a few blits instead of two per tile
+
+#include <stdlib.h>
+#include <math.h>
+#include <allegro5/allegro.h>
+#include "tilecache.h"
+#include "tilemap.h"
+#include "profile.h"
+
+#define BLOCK_PIXELS    (CACHE_BLOCK * TILE_SIZE)
+
+struct Block
+{
+    // Position (in blocks), the bitmap is NULL if it hasn't been used yet
+    int bx, by;
+    ALLEGRO_BITMAP* bmp;
+
+    // Look it was baked with, and whether there's anything to draw at all
+    int version;
+    int empty;
+    int tiles;
+
+    // Frame where it was last drawn
+    int last_used;
+};
+
+struct Tilecache
+{
+    struct Tilemap* map;
+    struct Block blocks[CACHE_SIZE];
+
+    ALLEGRO_BITMAP* tiles;
+    ALLEGRO_BITMAP* cracks;
+    int crack;
+
+    // Goes up every time the look changes
+    int version;
+    int frame;
+};
+
+struct Tilecache* create_tilecache(struct Tilemap* map, ALLEGRO_BITMAP* cracks)
+{
+    int i;
+    struct Tilecache* cache = malloc(sizeof(struct Tilecache));
+
+    cache->map = map;
+    cache->tiles = NULL;
+    cache->cracks = cracks;
+    cache->crack = 0;
+    cache->version = 0;
+    cache->frame = 0;
+
+    for (i=0; i<CACHE_SIZE; ++i)
+    {
+        cache->blocks[i].bmp = NULL;
+        cache->blocks[i].version = -1;
+        cache->blocks[i].last_used = -1;
+    }
+
+    return cache;
+}
+
+void destroy_tilecache(struct Tilecache* cache)
+{
+    int i;
+
+    for (i=0; i<CACHE_SIZE; ++i)
+    {
+        if (cache->blocks[i].bmp != NULL)
+        {
+            al_destroy_bitmap(cache->blocks[i].bmp);
+        }
+    }
+
+    free(cache);
+}
+
+void tilecache_set_look(struct Tilecache* cache, ALLEGRO_BITMAP* tiles,
+  int crack)
+{
+    if (tiles != cache->tiles || crack != cache->crack)
+    {
+        cache->tiles = tiles;
+        cache->crack = crack;
+        ++cache->version;
+    }
+}
+
+static void bake(struct Tilecache* cache, struct Block* b)
+{
+    int i, j;
+    struct Tilemap* map = cache->map;
+    ALLEGRO_BITMAP* target = al_get_target_bitmap();
+    ALLEGRO_TRANSFORM trans, identity;
+    int held = al_is_bitmap_drawing_held();
+
+    // Can't switch targets while drawing is held
+    if (held)
+    {
+        al_hold_bitmap_drawing(0);
+    }
+
+    if (b->bmp == NULL)
+    {
+        b->bmp = al_create_bitmap(BLOCK_PIXELS, BLOCK_PIXELS);
+    }
+
+    al_copy_transform(&trans, al_get_current_transform());
+
+    al_set_target_bitmap(b->bmp);
+    al_identity_transform(&identity);
+    al_use_transform(&identity);
+    al_clear_to_color(al_map_rgba(0, 0, 0, 0));
+
+    b->empty = 1;
+    b->tiles = 0;
+    al_hold_bitmap_drawing(1);
+
+    for (i=0; i<CACHE_BLOCK; ++i)
+    {
+        for (j=0; j<CACHE_BLOCK; ++j)
+        {
+            int id = tilemap_get(map, b->bx * CACHE_BLOCK + i,
+                b->by * CACHE_BLOCK + j);
+
+            if (id == 0)
+            {
+                continue;
+            }
+
+            al_draw_bitmap_region(cache->tiles,
+                map->types[id - 1].left, map->types[id - 1].top,
+                TILE_SIZE, TILE_SIZE, i * TILE_SIZE, j * TILE_SIZE, 0);
+
+            b->empty = 0;
+            ++b->tiles;
+        }
+    }
+
+    // Cracks go on top, in a second pass to avoid switching textures
+    for (i=0; i<CACHE_BLOCK; ++i)
+    {
+        for (j=0; j<CACHE_BLOCK; ++j)
+        {
+            if (tilemap_get(map, b->bx * CACHE_BLOCK + i,
+                b->by * CACHE_BLOCK + j))
+            {
+                al_draw_bitmap_region(cache->cracks,
+                    cache->crack * TILE_SIZE, 0, TILE_SIZE, TILE_SIZE,
+                    i * TILE_SIZE, j * TILE_SIZE, 0);
+            }
+        }
+    }
+
+    al_hold_bitmap_drawing(0);
+
+    // A tile and a crack each
+    profile_count(STAT_DRAW_CALLS, b->tiles * 2);
+
+    al_set_target_bitmap(target);
+    al_use_transform(&trans);
+
+    if (held)
+    {
+        al_hold_bitmap_drawing(1);
+    }
+
+    b->version = cache->version;
+}
+
+// Finds a block in the cache, or takes the least recently used one
+static struct Block* get_block(struct Tilecache* cache, int bx, int by)
+{
+    int i;
+    struct Block* lru = &cache->blocks[0];
+
+    for (i=0; i<CACHE_SIZE; ++i)
+    {
+        struct Block* b = &cache->blocks[i];
+
+        if (b->last_used >= 0 && b->bx == bx && b->by == by)
+        {
+            lru = b;
+            break;
+        }
+
+        if (b->last_used < lru->last_used)
+        {
+            lru = b;
+        }
+    }
+
+    if (lru->last_used < 0 || lru->bx != bx || lru->by != by)
+    {
+        lru->bx = bx;
+        lru->by = by;
+        lru->version = -1;
+    }
+
+    lru->last_used = cache->frame;
+
+    if (lru->version != cache->version)
+    {
+        bake(cache, lru);
+    }
+
+    return lru;
+}
+
+void tilecache_draw(struct Tilecache* cache, float x, float y, int w, int h)
+{
+    int bx, by, bx1, by1, bx2, by2;
+
+    if (cache->tiles == NULL)
+    {
+        return;
+    }
+
+    ++cache->frame;
+
+    bx1 = floor(x / BLOCK_PIXELS);
+    by1 = floor(y / BLOCK_PIXELS);
+    bx2 = floor((x + w - 1) / BLOCK_PIXELS);
+    by2 = floor((y + h - 1) / BLOCK_PIXELS);
+
+    // Nothing to bake outside of the level
+    if (bx1 < 0)
+    {
+        bx1 = 0;
+    }
+
+    if (by1 < 0)
+    {
+        by1 = 0;
+    }
+
+    if (bx2 * CACHE_BLOCK >= cache->map->cols)
+    {
+        bx2 = (cache->map->cols - 1) / CACHE_BLOCK;
+    }
+
+    if (by2 * CACHE_BLOCK >= cache->map->rows)
+    {
+        by2 = (cache->map->rows - 1) / CACHE_BLOCK;
+    }
+
+    for (bx=bx1; bx<=bx2; ++bx)
+    {
+        for (by=by1; by<=by2; ++by)
+        {
+            struct Block* b = get_block(cache, bx, by);
+
+            if (!b->empty)
+            {
+                al_draw_bitmap(b->bmp, bx * BLOCK_PIXELS - x,
+                    by * BLOCK_PIXELS - y, 0);
+
+                profile_count_blit(b->bmp, bx * BLOCK_PIXELS - x,
+                    by * BLOCK_PIXELS - y, BLOCK_PIXELS, BLOCK_PIXELS);
+                profile_count(STAT_TILES_DRAWN, b->tiles);
+            }
+        }
+    }
+}
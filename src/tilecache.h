@@ -0,0 +1,26 @@
+#ifndef TILECACHE_H_INCLUDED
+#define TILECACHE_H_INCLUDED
+
+#include <allegro5/allegro.h>
+
+struct Tilemap;
+
+// Size of every pre-rendered block (in cells)
+#define CACHE_BLOCK     16
+
+// How many blocks are kept baked (the least recently used one goes first)
+#define CACHE_SIZE      12
+
+struct Tilecache;
+
+struct Tilecache* create_tilecache(struct Tilemap*, ALLEGRO_BITMAP* cracks);
+void destroy_tilecache(struct Tilecache*);
+
+// Tileset and crack frame to bake with; blocks are only baked again after
+// one of these changes
+void tilecache_set_look(struct Tilecache*, ALLEGRO_BITMAP* tiles, int crack);
+
+// Draws the part of the level that's inside the view
+void tilecache_draw(struct Tilecache*, float x, float y, int w, int h);
+
+#endif // TILECACHE_H_INCLUDED
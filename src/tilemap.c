@@ -0,0 +1,539 @@
+// Level grid: a small palette of tiles plus one byte per 32x32 cell,
+// streamed in strips of CHUNK_COLS columns
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <allegro5/allegro.h>
+#include "tilemap.h"
+#include "trace.h"
+
+// Text levels are parsed this many chunks at a time
+#define TXT_WINDOW      64
+
+// Returns NULL if there's no memory for the chunks
+static struct Tilemap* create_tilemap(int cols, int rows)
+{
+    int i;
+    struct Tilemap* map = malloc(sizeof(struct Tilemap));
+
+    if (map == NULL)
+    {
+        return NULL;
+    }
+
+    map->cols = cols;
+    map->rows = rows;
+    map->type_count = 0;
+    map->tile_count = 0;
+
+    map->file = NULL;
+    map->offset = 0;
+    map->temp_path = NULL;
+    map->chunk_loads = 0;
+    map->chunk_misses = 0;
+
+    for (i=0; i<MAX_CHUNKS; ++i)
+    {
+        map->chunks[i].index = -1;
+        map->chunks[i].cells = malloc(CHUNK_COLS * rows);
+
+        if (map->chunks[i].cells == NULL)
+        {
+            destroy_tilemap(map);
+            return NULL;
+        }
+    }
+
+    return map;
+}
+
+void destroy_tilemap(struct Tilemap* map)
+{
+    int i;
+
+    for (i=0; i<MAX_CHUNKS; ++i)
+    {
+        free(map->chunks[i].cells);
+    }
+
+    if (map->file != NULL)
+    {
+        al_fclose(map->file);
+    }
+
+    if (map->temp_path != NULL)
+    {
+        al_remove_filename(al_path_cstr(map->temp_path,
+            ALLEGRO_NATIVE_PATH_SEP));
+        al_destroy_path(map->temp_path);
+    }
+
+    free(map);
+}
+
+struct Tilemap* load_tilemap(ALLEGRO_FILE* f)
+{
+    char magic[4];
+    int i, cols, rows, tile_count, type_count;
+    struct Tilemap* map;
+
+    if (al_fread(f, magic, 4) != 4 || memcmp(magic, "LVL1", 4) != 0)
+    {
+        puts("ERROR: Not a compiled level file");
+        al_fclose(f);
+        return NULL;
+    }
+
+    cols = al_fread32le(f);
+    rows = al_fread32le(f);
+    tile_count = al_fread32le(f);
+    type_count = al_fread32le(f);
+
+    if (cols < 0 || rows < 0 || type_count < 0 || type_count > MAX_TILE_TYPES)
+    {
+        puts("ERROR: Corrupted level header");
+        al_fclose(f);
+        return NULL;
+    }
+
+    map = create_tilemap(cols, rows);
+
+    if (map == NULL)
+    {
+        puts("ERROR: Not enough memory for the level");
+        al_fclose(f);
+        return NULL;
+    }
+
+    for (i=0; i<type_count; ++i)
+    {
+        map->types[i].left = al_fread16le(f);
+        map->types[i].top = al_fread16le(f);
+    }
+
+    map->type_count = type_count;
+    map->tile_count = tile_count;
+
+    map->file = f;
+    map->offset = al_ftell(f);
+
+    return map;
+}
+
+// Reads the next tile from a level file; returns 0 at the end
+static int read_tile(ALLEGRO_FILE* f, int* left, int* top, int* col, int* row)
+{
+    char line[100];
+
+    while (al_fgets(f, line, 100) != NULL)
+    {
+        int v, w, h;
+        float x, y;
+
+        if (sscanf(line, "%d %d %d %d %d %f %f", &v, left, top, &w, &h,
+            &x, &y) == 7)
+        {
+            *col = floor(x / TILE_SIZE);
+            *row = floor(y / TILE_SIZE);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+// Returns the palette index for a tile (adding it if it's new), or 0 if full
+static int add_type(struct Tilemap* map, int left, int top)
+{
+    int i;
+
+    for (i=0; i<map->type_count; ++i)
+    {
+        if (map->types[i].left == left && map->types[i].top == top)
+        {
+            return i + 1;
+        }
+    }
+
+    if (map->type_count == MAX_TILE_TYPES)
+    {
+        puts("WARNING: Too many different tiles in the level");
+        return 0;
+    }
+
+    map->types[map->type_count].left = left;
+    map->types[map->type_count].top = top;
+
+    return ++map->type_count;
+}
+
+// Cells of the chunks from 'first' on that fit in the window
+static int64_t window_size(struct Tilemap* map, int first)
+{
+    int cols = map->cols - first * CHUNK_COLS;
+
+    return (int64_t) (cols < TXT_WINDOW * CHUNK_COLS ? cols
+        : TXT_WINDOW * CHUNK_COLS) * map->rows;
+}
+
+// Reads the chunks from 'first' on into the window; the temporary file
+// only grows as chunks are written, anything after its end is empty
+static void read_window(struct Tilemap* map, unsigned char* window,
+  int first)
+{
+    int64_t size = window_size(map, first);
+    size_t got = 0;
+
+    if (al_fseek(map->file, (int64_t) first * CHUNK_COLS * map->rows,
+        ALLEGRO_SEEK_SET))
+    {
+        got = al_fread(map->file, window, size);
+    }
+
+    memset(window + got, 0, size - got);
+}
+
+// Writes the window back, keeping track of where the file ends
+static int write_window(struct Tilemap* map, unsigned char* window,
+  int first, int64_t* end)
+{
+    int64_t pos = (int64_t) first * CHUNK_COLS * map->rows;
+    int64_t size = window_size(map, first);
+
+    if (!al_fseek(map->file, pos, ALLEGRO_SEEK_SET)
+        || al_fwrite(map->file, window, size) != (size_t) size)
+    {
+        return 0;
+    }
+
+    if (pos + size > *end)
+    {
+        *end = pos + size;
+    }
+
+    return 1;
+}
+
+struct Tilemap* load_tilemap_txt(ALLEGRO_FILE* f)
+{
+    int left, top, col, row;
+    int cols = 0, rows = 0;
+    int first = -1, failed = 0;
+    int64_t end = 0;
+    unsigned char* window;
+    struct Tilemap* map;
+
+    trace_begin("load_tilemap_txt");
+
+    // First pass to know the size of the grid
+    while (read_tile(f, &left, &top, &col, &row))
+    {
+        if (col >= cols)
+        {
+            cols = col + 1;
+        }
+
+        if (row >= rows)
+        {
+            rows = row + 1;
+        }
+    }
+
+    map = create_tilemap(cols, rows);
+    window = malloc((size_t) TXT_WINDOW * CHUNK_COLS * rows + 1);
+
+    if (map == NULL || window == NULL)
+    {
+        puts("ERROR: Not enough memory for the level");
+        free(window);
+
+        if (map != NULL)
+        {
+            destroy_tilemap(map);
+        }
+
+        trace_end("load_tilemap_txt");
+        return NULL;
+    }
+
+    // Cells go to a temporary file in the compiled layout, and the level
+    // is streamed from there like a compiled one (so it never has to fit
+    // in memory)
+    map->file = al_make_temp_file("levelXXXXXX", &map->temp_path);
+
+    if (map->file == NULL)
+    {
+        puts("ERROR: Could not create a temporary file for the level");
+        free(window);
+        destroy_tilemap(map);
+        trace_end("load_tilemap_txt");
+        return NULL;
+    }
+
+    al_fseek(f, 0, ALLEGRO_SEEK_SET);
+
+    while (read_tile(f, &left, &top, &col, &row))
+    {
+        unsigned char* cell;
+
+        if (col < 0 || row < 0)
+        {
+            puts("WARNING: Ignoring tile with negative position");
+            continue;
+        }
+
+        // Levels are mostly listed column by column, so the window only
+        // moves now and then
+        if (first < 0 || col / CHUNK_COLS < first
+            || col / CHUNK_COLS >= first + TXT_WINDOW)
+        {
+            if (first >= 0 && !write_window(map, window, first, &end))
+            {
+                failed = 1;
+                break;
+            }
+
+            first = col / CHUNK_COLS;
+            read_window(map, window, first);
+        }
+
+        cell = &window[(col - first * CHUNK_COLS) * rows + row];
+
+        if (*cell == 0)
+        {
+            ++map->tile_count;
+        }
+
+        *cell = add_type(map, left, top);
+    }
+
+    if (!failed && first >= 0)
+    {
+        failed = !write_window(map, window, first, &end);
+    }
+
+    // The file has to be as long as the grid, even if the last columns
+    // are empty
+    if (!failed && end < (int64_t) cols * rows)
+    {
+        failed = !al_fseek(map->file, (int64_t) cols * rows - 1,
+            ALLEGRO_SEEK_SET) || al_fputc(map->file, 0) == EOF;
+    }
+
+    if (failed)
+    {
+        puts("ERROR: Could not write the temporary file for the level");
+        free(window);
+        destroy_tilemap(map);
+        trace_end("load_tilemap_txt");
+        return NULL;
+    }
+
+    free(window);
+
+    trace_end("load_tilemap_txt");
+
+    return map;
+}
+
+struct Tilemap* load_tilemap_file(const char* filename)
+{
+    char magic[4];
+    struct Tilemap* map;
+    ALLEGRO_FILE* f = al_fopen(filename, "rb");
+
+    if (f == NULL)
+    {
+        printf("ERROR: Could not open level %s\n", filename);
+        return NULL;
+    }
+
+    // Compiled levels keep the file open to stream from it
+    if (al_fread(f, magic, 4) == 4 && memcmp(magic, "LVL1", 4) == 0)
+    {
+        al_fseek(f, 0, ALLEGRO_SEEK_SET);
+        return load_tilemap(f);
+    }
+
+    al_fseek(f, 0, ALLEGRO_SEEK_SET);
+    map = load_tilemap_txt(f);
+    al_fclose(f);
+
+    if (map == NULL)
+    {
+        return NULL;
+    }
+
+    if (map->tile_count == 0)
+    {
+        printf("ERROR: No tiles in level %s\n", filename);
+        destroy_tilemap(map);
+        return NULL;
+    }
+
+    return map;
+}
+
+static struct Chunk* load_chunk(struct Tilemap* map, int index)
+{
+    struct Chunk* chunk = &map->chunks[index % MAX_CHUNKS];
+
+    if (chunk->index != index)
+    {
+        int size = CHUNK_COLS * map->rows;
+        int64_t pos = map->offset + (int64_t) index * size;
+
+        trace_begin("load_chunk");
+
+        // The last chunk may be shorter, the rest is left empty
+        if ((index + 1) * CHUNK_COLS > map->cols)
+        {
+            size = (map->cols - index * CHUNK_COLS) * map->rows;
+            memset(chunk->cells + size, 0, CHUNK_COLS * map->rows - size);
+        }
+
+        if (!al_fseek(map->file, pos, ALLEGRO_SEEK_SET)
+            || al_fread(map->file, chunk->cells, size) != (size_t) size)
+        {
+            puts("WARNING: Could not read level chunk");
+            memset(chunk->cells, 0, size);
+        }
+
+        chunk->index = index;
+        ++map->chunk_loads;
+
+        trace_end("load_chunk");
+    }
+
+    return chunk;
+}
+
+void tilemap_stream(struct Tilemap* map, float x, float w, float speed)
+{
+    int i, first, last;
+    float ahead = speed * READ_AHEAD;
+
+    // Visible columns plus a small margin, stretched towards where the
+    // camera is going
+    first = floor((x - TILE_SIZE * 2 + (ahead < 0 ? ahead : 0))
+        / (CHUNK_COLS * TILE_SIZE));
+    last = floor((x + w + TILE_SIZE * 2 + (ahead > 0 ? ahead : 0))
+        / (CHUNK_COLS * TILE_SIZE));
+
+    // Never ask for more than what fits, keeping the side we're moving to
+    if (last - first >= MAX_CHUNKS)
+    {
+        if (speed < 0)
+        {
+            last = first + MAX_CHUNKS - 1;
+        }
+        else
+        {
+            first = last - MAX_CHUNKS + 1;
+        }
+    }
+
+    if (first < 0)
+    {
+        first = 0;
+    }
+
+    if (last * CHUNK_COLS >= map->cols)
+    {
+        last = (map->cols - 1) / CHUNK_COLS;
+    }
+
+    for (i=first; i<=last; ++i)
+    {
+        load_chunk(map, i);
+    }
+}
+
+int tilemap_get(struct Tilemap* map, int col, int row)
+{
+    struct Chunk* chunk;
+
+    if (col < 0 || row < 0 || col >= map->cols || row >= map->rows)
+    {
+        return 0;
+    }
+
+    chunk = &map->chunks[(col / CHUNK_COLS) % MAX_CHUNKS];
+
+    if (chunk->index != col / CHUNK_COLS)
+    {
+        ++map->chunk_misses;
+        chunk = load_chunk(map, col / CHUNK_COLS);
+    }
+
+    return chunk->cells[(col % CHUNK_COLS) * map->rows + row];
+}
+
+int tilemap_get_range(struct Tilemap* map, float x, float y, float w, float h,
+  int* col1, int* row1, int* col2, int* row2)
+{
+    // Cells touched by [x, x + w) and [y, y + h)
+    *col1 = floor(x / TILE_SIZE);
+    *row1 = floor(y / TILE_SIZE);
+    *col2 = ceil((x + w) / TILE_SIZE) - 1;
+    *row2 = ceil((y + h) / TILE_SIZE) - 1;
+
+    if (*col1 < 0)
+    {
+        *col1 = 0;
+    }
+
+    if (*row1 < 0)
+    {
+        *row1 = 0;
+    }
+
+    if (*col2 >= map->cols)
+    {
+        *col2 = map->cols - 1;
+    }
+
+    if (*row2 >= map->rows)
+    {
+        *row2 = map->rows - 1;
+    }
+
+    return *col1 <= *col2 && *row1 <= *row2;
+}
+
+int tilemap_collide(struct Tilemap* map, float x, float y, float w, float h,
+  int* col, int* row)
+{
+    int c, r, col1, row1, col2, row2;
+    int hit = 0;
+
+    if (!tilemap_get_range(map, x, y, w, h, &col1, &row1, &col2, &row2))
+    {
+        return 0;
+    }
+
+    for (c=col1; c<=col2; ++c)
+    {
+        for (r=row1; r<=row2; ++r)
+        {
+            if (tilemap_get(map, c, r))
+            {
+                hit = 1;
+
+                if (col != NULL)
+                {
+                    *col = c;
+                }
+
+                if (row != NULL)
+                {
+                    *row = r;
+                }
+            }
+        }
+    }
+
+    return hit;
+}
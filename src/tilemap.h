@@ -0,0 +1,100 @@
+#ifndef TILEMAP_H_INCLUDED
+#define TILEMAP_H_INCLUDED
+
+#include <allegro5/allegro.h>
+
+// Width and height of every cell in the level grid
+#define TILE_SIZE       32
+
+// Cells are stored as bytes, 0 meaning "empty"
+#define MAX_TILE_TYPES  255
+
+// Levels are streamed in strips of this many columns
+#define CHUNK_COLS      32
+
+// How many chunks can be loaded at once (bounds memory for any level length)
+#define MAX_CHUNKS      8
+
+// How many ticks of camera movement to read ahead of
+#define READ_AHEAD      30
+
+struct Tile
+{
+    // Position in the tileset
+    int left, top;
+};
+
+struct Chunk
+{
+    // Which chunk is loaded in this slot (-1 for none)
+    int index;
+
+    // CHUNK_COLS * rows cells, column by column
+    unsigned char* cells;
+};
+
+struct Tilemap
+{
+    // Size of the grid (in cells)
+    int cols, rows;
+
+    // Tile palette, a cell with value N uses types[N - 1]
+    struct Tile types[MAX_TILE_TYPES];
+    int type_count;
+
+    // How many cells are not empty
+    int tile_count;
+
+    // Loaded chunks; chunk N can only live in slot N % MAX_CHUNKS, so any
+    // MAX_CHUNKS consecutive chunks can be loaded at the same time
+    struct Chunk chunks[MAX_CHUNKS];
+
+    // Where chunks are read from, and the offset of the first cell
+    ALLEGRO_FILE* file;
+    int64_t offset;
+
+    // Temporary file the cells were written to, for levels loaded from
+    // text (deleted with the tilemap)
+    ALLEGRO_PATH* temp_path;
+
+    // Chunks read so far, and how many of them weren't read ahead of time
+    int chunk_loads;
+    int chunk_misses;
+};
+
+// The tilemap takes ownership of the file (it's closed by destroy_tilemap)
+void destroy_tilemap(struct Tilemap*);
+
+// Loads a level compiled with tools/levelc (the "LVL1" binary format):
+//   "LVL1", cols, rows, tile count, type count (32-bit little-endian)
+//   type count * left, top (16-bit)
+//   cols * rows cells (a byte each, column by column)
+// Only the header is read here, cells are streamed in later
+struct Tilemap* load_tilemap(ALLEGRO_FILE*);
+
+// Loads a level in the text format (one "v left top w h x y" per line)
+// The cells are copied to a temporary file and streamed from there, so the
+// file can be closed afterwards. Returns NULL on failure.
+struct Tilemap* load_tilemap_txt(ALLEGRO_FILE*);
+
+// Loads a level from disk in either format; returns NULL on failure
+struct Tilemap* load_tilemap_file(const char* filename);
+
+// Loads the chunks around the camera, reading ahead in the direction it's
+// moving (speed is in pixels per tick)
+void tilemap_stream(struct Tilemap*, float x, float w, float speed);
+
+// Returns 0 for empty cells or cells outside of the grid
+// Chunks that aren't loaded yet are read right away
+int tilemap_get(struct Tilemap*, int col, int row);
+
+// Range of cells covered by a rectangle (clamped to the grid)
+// Returns 0 if the rectangle is completely outside
+int tilemap_get_range(struct Tilemap*, float x, float y, float w, float h,
+    int* col1, int* row1, int* col2, int* row2);
+
+// Checks a rectangle against the grid, storing the last cell that was hit
+int tilemap_collide(struct Tilemap*, float x, float y, float w, float h,
+    int* col, int* row);
+
+#endif // TILEMAP_H_INCLUDED
@@ -0,0 +1,328 @@
+// Level geometry kept in vertex buffers, one per chunk, each cell being a
+// tile quad followed by its crack quad
+
+#include <stdlib.h>
+#include <math.h>
+#include <allegro5/allegro.h>
+#include <allegro5/allegro_primitives.h>
+#include "tilemesh.h"
+#include "tilemap.h"
+#include "profile.h"
+
+// Vertex buffers are stable since 5.2
+#if ALLEGRO_VERSION_INT >= AL_ID(5, 2, 0, 0)
+#define HAVE_VERTEX_BUFFERS
+#endif
+
+// Two quads per cell, drawn as triangle lists
+#define QUAD_VERTICES   6
+#define CELL_VERTICES   (QUAD_VERTICES * 2)
+
+#ifdef HAVE_VERTEX_BUFFERS
+
+struct Mesh
+{
+    // Chunk this mesh was built for (-1 for none)
+    int index;
+
+    // NULL if the chunk has no tiles
+    ALLEGRO_VERTEX_BUFFER* vb;
+
+    // First vertex of every column, so visible columns are a single range
+    int col_start[CHUNK_COLS + 1];
+
+    // Look the texture coordinates are set for
+    float tiles_x, tiles_y;
+    int crack;
+};
+
+struct Tilemesh
+{
+    struct Tilemap* map;
+
+    // Same slots as the chunks in the tilemap
+    struct Mesh meshes[MAX_CHUNKS];
+
+    // Texture shared by tiles and cracks, and where both sheets are in it
+    ALLEGRO_BITMAP* texture;
+    float tiles_x, tiles_y;
+    float cracks_x, cracks_y;
+    int crack;
+};
+
+static void set_quad(ALLEGRO_VERTEX* v, float x, float y, float u, float tv)
+{
+    int i;
+
+    // Two triangles: top-left, top-right, bottom-left / same for bottom-right
+    static const int corners[QUAD_VERTICES][2] =
+    {
+        { 0, 0 }, { 1, 0 }, { 0, 1 },
+        { 1, 0 }, { 1, 1 }, { 0, 1 }
+    };
+
+    for (i=0; i<QUAD_VERTICES; ++i)
+    {
+        v[i].x = x + corners[i][0] * TILE_SIZE;
+        v[i].y = y + corners[i][1] * TILE_SIZE;
+        v[i].z = 0;
+        v[i].u = u + corners[i][0] * TILE_SIZE;
+        v[i].v = tv + corners[i][1] * TILE_SIZE;
+        v[i].color = al_map_rgb_f(1, 1, 1);
+    }
+}
+
+static void build_mesh(struct Tilemesh* mesh, struct Mesh* m, int index)
+{
+    int i, j, count = 0;
+    struct Tilemap* map = mesh->map;
+    ALLEGRO_VERTEX* vtx;
+
+    if (m->vb != NULL)
+    {
+        al_destroy_vertex_buffer(m->vb);
+        m->vb = NULL;
+    }
+
+    vtx = malloc(sizeof(ALLEGRO_VERTEX) * CELL_VERTICES * CHUNK_COLS * map->rows);
+
+    for (i=0; i<CHUNK_COLS; ++i)
+    {
+        int col = index * CHUNK_COLS + i;
+        m->col_start[i] = count;
+
+        for (j=0; j<map->rows; ++j)
+        {
+            int id = tilemap_get(map, col, j);
+
+            if (id == 0)
+            {
+                continue;
+            }
+
+            set_quad(&vtx[count], col * TILE_SIZE, j * TILE_SIZE,
+                mesh->tiles_x + map->types[id - 1].left,
+                mesh->tiles_y + map->types[id - 1].top);
+
+            set_quad(&vtx[count + QUAD_VERTICES], col * TILE_SIZE,
+                j * TILE_SIZE,
+                mesh->cracks_x + mesh->crack * TILE_SIZE, mesh->cracks_y);
+
+            count += CELL_VERTICES;
+        }
+    }
+
+    m->col_start[CHUNK_COLS] = count;
+
+    if (count > 0)
+    {
+        // Read/write so the look can be changed in place
+        m->vb = al_create_vertex_buffer(NULL, vtx, count,
+            ALLEGRO_PRIM_BUFFER_DYNAMIC | ALLEGRO_PRIM_BUFFER_READWRITE);
+    }
+
+    free(vtx);
+
+    m->index = index;
+    m->tiles_x = mesh->tiles_x;
+    m->tiles_y = mesh->tiles_y;
+    m->crack = mesh->crack;
+}
+
+// Moves the texture coordinates of a mesh to the current look
+static void update_look(struct Tilemesh* mesh, struct Mesh* m)
+{
+    int i, j, count = m->col_start[CHUNK_COLS];
+    float du = mesh->tiles_x - m->tiles_x;
+    float dv = mesh->tiles_y - m->tiles_y;
+    float dcrack = (mesh->crack - m->crack) * TILE_SIZE;
+    ALLEGRO_VERTEX* vtx;
+
+    if (m->vb == NULL)
+    {
+        return;
+    }
+
+    vtx = al_lock_vertex_buffer(m->vb, 0, count, ALLEGRO_LOCK_READWRITE);
+
+    if (vtx == NULL)
+    {
+        return;
+    }
+
+    for (i=0; i<count; i+=CELL_VERTICES)
+    {
+        for (j=0; j<QUAD_VERTICES; ++j)
+        {
+            vtx[i + j].u += du;
+            vtx[i + j].v += dv;
+            vtx[i + QUAD_VERTICES + j].u += dcrack;
+        }
+    }
+
+    al_unlock_vertex_buffer(m->vb);
+
+    m->tiles_x = mesh->tiles_x;
+    m->tiles_y = mesh->tiles_y;
+    m->crack = mesh->crack;
+}
+
+struct Tilemesh* create_tilemesh(struct Tilemap* map)
+{
+    int i;
+    struct Tilemesh* mesh;
+    ALLEGRO_VERTEX test[QUAD_VERTICES];
+    ALLEGRO_VERTEX_BUFFER* vb;
+
+    // Vertex buffers belong to a display; without one (headless) there's
+    // nothing to ask, and Allegro would look at a NULL display
+    if (al_get_current_display() == NULL)
+    {
+        return NULL;
+    }
+
+    // Check if the display can do vertex buffers at all
+    set_quad(test, 0, 0, 0, 0);
+    vb = al_create_vertex_buffer(NULL, test, QUAD_VERTICES,
+        ALLEGRO_PRIM_BUFFER_DYNAMIC | ALLEGRO_PRIM_BUFFER_READWRITE);
+
+    if (vb == NULL)
+    {
+        return NULL;
+    }
+
+    al_destroy_vertex_buffer(vb);
+
+    mesh = malloc(sizeof(struct Tilemesh));
+    mesh->map = map;
+    mesh->texture = NULL;
+    mesh->tiles_x = mesh->tiles_y = 0;
+    mesh->cracks_x = mesh->cracks_y = 0;
+    mesh->crack = 0;
+
+    for (i=0; i<MAX_CHUNKS; ++i)
+    {
+        mesh->meshes[i].index = -1;
+        mesh->meshes[i].vb = NULL;
+    }
+
+    return mesh;
+}
+
+void destroy_tilemesh(struct Tilemesh* mesh)
+{
+    int i;
+
+    for (i=0; i<MAX_CHUNKS; ++i)
+    {
+        if (mesh->meshes[i].vb != NULL)
+        {
+            al_destroy_vertex_buffer(mesh->meshes[i].vb);
+        }
+    }
+
+    free(mesh);
+}
+
+void tilemesh_set_look(struct Tilemesh* mesh, ALLEGRO_BITMAP* tiles,
+  ALLEGRO_BITMAP* cracks, int crack)
+{
+    // Coordinates are given in the parent texture
+    mesh->texture = al_get_parent_bitmap(tiles);
+
+    if (mesh->texture == NULL)
+    {
+        mesh->texture = tiles;
+    }
+
+    mesh->tiles_x = al_get_bitmap_x(tiles);
+    mesh->tiles_y = al_get_bitmap_y(tiles);
+    mesh->cracks_x = al_get_bitmap_x(cracks);
+    mesh->cracks_y = al_get_bitmap_y(cracks);
+    mesh->crack = crack;
+}
+
+void tilemesh_draw(struct Tilemesh* mesh, float x, float y, int w, int h)
+{
+    int i, col1, row1, col2, row2;
+    int held = al_is_bitmap_drawing_held();
+    ALLEGRO_TRANSFORM old, trans;
+
+    if (mesh->texture == NULL || !tilemap_get_range(mesh->map, x, y, w, h,
+        &col1, &row1, &col2, &row2))
+    {
+        return;
+    }
+
+    if (held)
+    {
+        al_hold_bitmap_drawing(0);
+    }
+
+    // Vertices are in level coordinates, the view is just a transform
+    al_copy_transform(&old, al_get_current_transform());
+    al_identity_transform(&trans);
+    al_translate_transform(&trans, -x, -y);
+    al_compose_transform(&trans, &old);
+    al_use_transform(&trans);
+
+    for (i=col1 / CHUNK_COLS; i<=col2 / CHUNK_COLS; ++i)
+    {
+        struct Mesh* m = &mesh->meshes[i % MAX_CHUNKS];
+        int first = (i == col1 / CHUNK_COLS ? col1 % CHUNK_COLS : 0);
+        int last = (i == col2 / CHUNK_COLS ? col2 % CHUNK_COLS : CHUNK_COLS - 1);
+
+        if (m->index != i)
+        {
+            build_mesh(mesh, m, i);
+        }
+        else if (m->crack != mesh->crack || m->tiles_x != mesh->tiles_x
+            || m->tiles_y != mesh->tiles_y)
+        {
+            update_look(mesh, m);
+        }
+
+        if (m->vb != NULL && m->col_start[first] < m->col_start[last + 1])
+        {
+            int count = m->col_start[last + 1] - m->col_start[first];
+
+            al_draw_vertex_buffer(m->vb, mesh->texture, m->col_start[first],
+                m->col_start[last + 1], ALLEGRO_PRIM_TRIANGLE_LIST);
+
+            // Every cell is a tile and a crack quad
+            profile_count_prim(mesh->texture,
+                count / QUAD_VERTICES * TILE_SIZE * TILE_SIZE);
+            profile_count(STAT_TILES_DRAWN, count / CELL_VERTICES);
+        }
+    }
+
+    al_use_transform(&old);
+
+    if (held)
+    {
+        al_hold_bitmap_drawing(1);
+    }
+}
+
+#else
+
+// Older Allegro versions always fall back to the Tilecache
+struct Tilemesh* create_tilemesh(struct Tilemap* map)
+{
+    return NULL;
+}
+
+void destroy_tilemesh(struct Tilemesh* mesh)
+{
+}
+
+void tilemesh_set_look(struct Tilemesh* mesh, ALLEGRO_BITMAP* tiles,
+  ALLEGRO_BITMAP* cracks, int crack)
+{
+}
+
+void tilemesh_draw(struct Tilemesh* mesh, float x, float y, int w, int h)
+{
+}
+
+#endif
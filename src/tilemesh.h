@@ -0,0 +1,22 @@
+#ifndef TILEMESH_H_INCLUDED
+#define TILEMESH_H_INCLUDED
+
+#include <allegro5/allegro.h>
+
+struct Tilemap;
+
+struct Tilemesh;
+
+// Returns NULL if vertex buffers aren't supported (use a Tilecache then)
+struct Tilemesh* create_tilemesh(struct Tilemap*);
+void destroy_tilemesh(struct Tilemesh*);
+
+// Tileset and crack frame to draw with; both sheets have to be in the same
+// texture (the atlas), and changing them only moves texture coordinates
+void tilemesh_set_look(struct Tilemesh*, ALLEGRO_BITMAP* tiles,
+    ALLEGRO_BITMAP* cracks, int crack);
+
+// Draws the part of the level that's inside the view
+void tilemesh_draw(struct Tilemesh*, float x, float y, int w, int h);
+
+#endif // TILEMESH_H_INCLUDED
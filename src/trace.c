@@ -0,0 +1,138 @@
+// Trace events, kept in a ring buffer until they're written
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <allegro5/allegro.h>
+#include "trace.h"
+
+struct Event
+{
+    const char* name;
+    char phase; // 'B'egin, 'E'nd or 'i'nstant
+    double time;
+};
+
+static struct
+{
+    const char* filename;
+    struct Event* events;
+
+    // Events ever added; the ring has the last TRACE_EVENTS of them
+    unsigned int count;
+
+    double start;
+}
+trace =
+{
+    NULL, NULL,
+    0,
+    0
+};
+
+int trace_open(const char* filename)
+{
+    trace_close();
+
+    trace.events = malloc(sizeof(struct Event) * TRACE_EVENTS);
+
+    if (trace.events == NULL)
+    {
+        puts("ERROR: Not enough memory for tracing");
+        return 0;
+    }
+
+    trace.filename = filename;
+    trace.count = 0;
+    trace.start = al_get_time();
+
+    return 1;
+}
+
+void trace_close()
+{
+    if (trace.events != NULL)
+    {
+        trace_flush();
+        free(trace.events);
+        trace.events = NULL;
+    }
+}
+
+static void add_event(const char* name, char phase)
+{
+    struct Event* e;
+
+    if (trace.events == NULL)
+    {
+        return;
+    }
+
+    e = &trace.events[trace.count % TRACE_EVENTS];
+    e->name = name;
+    e->phase = phase;
+    e->time = al_get_time();
+
+    ++trace.count;
+}
+
+void trace_begin(const char* name)
+{
+    add_event(name, 'B');
+}
+
+void trace_end(const char* name)
+{
+    add_event(name, 'E');
+}
+
+void trace_instant(const char* name)
+{
+    add_event(name, 'i');
+}
+
+void trace_flush()
+{
+    unsigned int i, first;
+    int depth = 0, comma = 0;
+    FILE* f;
+
+    if (trace.events == NULL)
+    {
+        return;
+    }
+
+    f = fopen(trace.filename, "w");
+
+    if (f == NULL)
+    {
+        printf("ERROR: Could not write trace to %s\n", trace.filename);
+        return;
+    }
+
+    first = (trace.count > TRACE_EVENTS ? trace.count - TRACE_EVENTS : 0);
+
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", f);
+
+    for (i=first; i<trace.count; ++i)
+    {
+        struct Event* e = &trace.events[i % TRACE_EVENTS];
+
+        // Spans that began before the oldest event kept
+        if (e->phase == 'E' && depth == 0)
+        {
+            continue;
+        }
+
+        depth += (e->phase == 'B') - (e->phase == 'E');
+
+        fprintf(f, "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.1f,"
+            "\"pid\":1,\"tid\":1%s}", comma ? ",\n" : "", e->name, e->phase,
+            (e->time - trace.start) * 1e6, e->phase == 'i' ? ",\"s\":\"t\""
+            : "");
+
+        comma = 1;
+    }
+
+    fputs("\n]}\n", f);
+    fclose(f);
+}
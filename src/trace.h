@@ -0,0 +1,23 @@
+#ifndef TRACE_H_INCLUDED
+#define TRACE_H_INCLUDED
+
+// Spans in the Chrome trace_event format (open the file in Perfetto or
+// chrome://tracing); names have to be string constants
+
+// Most recent events kept, older ones are dropped
+#define TRACE_EVENTS    65536
+
+// Starts keeping events, which trace_flush() writes to the file
+int trace_open(const char* filename);
+void trace_close();
+
+void trace_begin(const char* name);
+void trace_end(const char* name);
+
+// Something that happened at a single point in time
+void trace_instant(const char* name);
+
+// Writes every event kept so far (replacing what the file had)
+void trace_flush();
+
+#endif // TRACE_H_INCLUDED
@@ -0,0 +1,235 @@
+// Level compiler: turns a level.txt into the binary format read by
+// load_tilemap() (see src/tilemap.h)
+//
+// Build with: gcc -O2 -o levelc tools/levelc.c -lm
+//
+// Usage: levelc level.txt level.lvl     (binary file)
+//        levelc -c level.txt level.c    (C array, like src/data/level.c)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// Keep in sync with src/tilemap.h
+#define TILE_SIZE       32
+#define MAX_TILE_TYPES  255
+
+static struct
+{
+    int left, top;
+}
+types[MAX_TILE_TYPES];
+
+static int type_count = 0;
+
+static int read_tile(FILE* f, int* left, int* top, int* col, int* row)
+{
+    char line[100];
+
+    while (fgets(line, 100, f) != NULL)
+    {
+        int v, w, h;
+        float x, y;
+
+        if (sscanf(line, "%d %d %d %d %d %f %f", &v, left, top, &w, &h,
+            &x, &y) == 7)
+        {
+            *col = floor(x / TILE_SIZE);
+            *row = floor(y / TILE_SIZE);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static int add_type(int left, int top)
+{
+    int i;
+
+    for (i=0; i<type_count; ++i)
+    {
+        if (types[i].left == left && types[i].top == top)
+        {
+            return i + 1;
+        }
+    }
+
+    if (type_count == MAX_TILE_TYPES)
+    {
+        return 0;
+    }
+
+    types[type_count].left = left;
+    types[type_count].top = top;
+
+    return ++type_count;
+}
+
+static unsigned char* put16(unsigned char* p, unsigned int v)
+{
+    *p++ = v & 0xFF;
+    *p++ = (v >> 8) & 0xFF;
+    return p;
+}
+
+static unsigned char* put32(unsigned char* p, unsigned int v)
+{
+    p = put16(p, v & 0xFFFF);
+    return put16(p, v >> 16);
+}
+
+// Writes the data the same way Any2c does
+static void write_c(FILE* out, const char* name, unsigned char* data,
+  unsigned int length)
+{
+    unsigned int i;
+    int column = 2;
+
+    fprintf(out, "/*\n  %s\n  %u bytes\n*/\n\n", name, length);
+    fprintf(out, "unsigned int level_lvl_length = %u;\n", length);
+    fprintf(out, "unsigned char level_lvl_data[%u] =\n{\n  ", length);
+
+    for (i=0; i<length; ++i)
+    {
+        char num[8];
+        int len = sprintf(num, i + 1 < length ? "%d," : "%d", data[i]);
+
+        if (column + len > 78)
+        {
+            fputs("\n  ", out);
+            column = 2;
+        }
+
+        fputs(num, out);
+        column += len;
+    }
+
+    fputs("\n};\n", out);
+}
+
+int main(int argc, char** argv)
+{
+    int as_c = 0;
+    int left, top, col, row;
+    unsigned int cols = 0, rows = 0, tile_count = 0, length;
+    unsigned char* cells;
+    unsigned char* data;
+    unsigned char* p;
+    FILE* in;
+    FILE* out;
+    int i;
+
+    if (argc > 1 && strcmp(argv[1], "-c") == 0)
+    {
+        as_c = 1;
+        --argc;
+        ++argv;
+    }
+
+    if (argc != 3)
+    {
+        puts("Usage: levelc [-c] level.txt output");
+        return 1;
+    }
+
+    in = fopen(argv[1], "r");
+
+    if (in == NULL)
+    {
+        printf("ERROR: Could not open %s\n", argv[1]);
+        return 1;
+    }
+
+    // First pass for the size of the grid
+    while (read_tile(in, &left, &top, &col, &row))
+    {
+        if (col >= (int) cols)
+        {
+            cols = col + 1;
+        }
+
+        if (row >= (int) rows)
+        {
+            rows = row + 1;
+        }
+    }
+
+    cells = calloc(cols * rows, 1);
+    rewind(in);
+
+    while (read_tile(in, &left, &top, &col, &row))
+    {
+        int id;
+
+        // Only tiles that are kept take a place in the palette
+        if (col < 0 || row < 0)
+        {
+            printf("WARNING: Skipping tile at cell %d,%d\n", col, row);
+            continue;
+        }
+
+        id = add_type(left, top);
+
+        if (id == 0)
+        {
+            printf("WARNING: Skipping tile at cell %d,%d\n", col, row);
+            continue;
+        }
+
+        if (cells[col * rows + row] == 0)
+        {
+            ++tile_count;
+        }
+
+        cells[col * rows + row] = id;
+    }
+
+    fclose(in);
+
+    // Header, tile palette and then the cells (column by column)
+    length = 20 + type_count * 4 + cols * rows;
+    data = malloc(length);
+
+    memcpy(data, "LVL1", 4);
+    p = put32(data + 4, cols);
+    p = put32(p, rows);
+    p = put32(p, tile_count);
+    p = put32(p, type_count);
+
+    for (i=0; i<type_count; ++i)
+    {
+        p = put16(p, types[i].left);
+        p = put16(p, types[i].top);
+    }
+
+    memcpy(p, cells, cols * rows);
+
+    out = fopen(argv[2], as_c ? "w" : "wb");
+
+    if (out == NULL)
+    {
+        printf("ERROR: Could not write %s\n", argv[2]);
+        return 1;
+    }
+
+    if (as_c)
+    {
+        write_c(out, "level.lvl", data, length);
+    }
+    else
+    {
+        fwrite(data, 1, length, out);
+    }
+
+    fclose(out);
+
+    printf("%ux%u cells, %u tiles, %d types, %u bytes\n", cols, rows,
+        tile_count, type_count, length);
+
+    free(cells);
+    free(data);
+
+    return 0;
+}
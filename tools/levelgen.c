@@ -0,0 +1,138 @@
+// Level generator: writes random levels in the level.txt format, for
+// testing how things scale with the size of the level
+//
+// Build with: gcc -O2 -o levelgen tools/levelgen.c
+//
+// Usage: levelgen [options] level.txt
+//   -c COLS      Length of the level, in columns (default 1000)
+//   -n TILES     Stop after this many tiles (sets the length if -c isn't given)
+//   -r ROWS      Vertical extent, in rows (default 15)
+//   -d DENSITY   Chance of a cell above the ground having a tile (default 0.1)
+//   -m MIX       How many different tiles to use, 1 to 14 (default 14)
+//   -s SEED      Random seed (default 1)
+//
+// The bottom row is always solid ground, so Luna can walk all of it
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Keep in sync with src/tilemap.h
+#define TILE_SIZE       32
+
+// Tiles used by the shipped level (left and top in the tileset)
+static const int tileset[][2] =
+{
+    { 96, 0 }, { 96, 32 }, { 0, 32 }, { 0, 64 }, { 64, 0 }, { 32, 32 },
+    { 32, 64 }, { 32, 0 }, { 0, 0 }, { 64, 32 }, { 0, 96 }, { 32, 96 },
+    { 64, 96 }, { 64, 64 }
+};
+
+#define TILESET_SIZE    (sizeof(tileset) / sizeof(tileset[0]))
+
+// Biggest level this will write
+#define MAX_TILES       10000000
+
+static void write_tile(FILE* out, int type, int col, int row)
+{
+    fprintf(out, "1 %d %d %d %d %d %d\n", tileset[type][0], tileset[type][1],
+        TILE_SIZE, TILE_SIZE, col * TILE_SIZE, row * TILE_SIZE);
+}
+
+int main(int argc, char** argv)
+{
+    int cols = 0, rows = 15, mix = TILESET_SIZE, seed = 1;
+    long tiles = 0, max_tiles = 0;
+    double density = 0.1;
+    int col, row, i;
+    FILE* out;
+
+    for (i=1; i<argc - 1; ++i)
+    {
+        if (strcmp(argv[i], "-c") == 0 && i + 2 < argc)
+        {
+            cols = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-n") == 0 && i + 2 < argc)
+        {
+            max_tiles = atol(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-r") == 0 && i + 2 < argc)
+        {
+            rows = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-d") == 0 && i + 2 < argc)
+        {
+            density = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-m") == 0 && i + 2 < argc)
+        {
+            mix = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-s") == 0 && i + 2 < argc)
+        {
+            seed = atoi(argv[++i]);
+        }
+        else
+        {
+            printf("WARNING: Unknown option %s\n", argv[i]);
+        }
+    }
+
+    if (argc < 2 || argv[argc - 1][0] == '-')
+    {
+        puts("Usage: levelgen [-c cols] [-n tiles] [-r rows] [-d density] "
+            "[-m mix] [-s seed] level.txt");
+        return 1;
+    }
+
+    if (rows < 1 || mix < 1 || mix > TILESET_SIZE || density < 0
+        || density > 1 || max_tiles < 0 || max_tiles > MAX_TILES)
+    {
+        puts("ERROR: Option out of range");
+        return 1;
+    }
+
+    // Every column has at least one tile, so that many columns is always
+    // enough for the number of tiles asked for
+    if (cols <= 0)
+    {
+        cols = (max_tiles > 0 ? max_tiles : 1000);
+    }
+
+    if (max_tiles == 0)
+    {
+        max_tiles = MAX_TILES;
+    }
+
+    out = fopen(argv[argc - 1], "w");
+
+    if (out == NULL)
+    {
+        printf("ERROR: Could not write %s\n", argv[argc - 1]);
+        return 1;
+    }
+
+    srand(seed);
+
+    for (col=0; col<cols && tiles<max_tiles; ++col)
+    {
+        write_tile(out, rand() % mix, col, rows - 1);
+        ++tiles;
+
+        for (row=0; row<rows - 1 && tiles<max_tiles; ++row)
+        {
+            if (rand() < density * ((double) RAND_MAX + 1))
+            {
+                write_tile(out, rand() % mix, col, row);
+                ++tiles;
+            }
+        }
+    }
+
+    fclose(out);
+
+    printf("%dx%d cells, %ld tiles\n", col, rows, tiles);
+
+    return 0;
+}
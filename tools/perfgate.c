@@ -0,0 +1,318 @@
+// Performance gate: plays recorded replays headless, and compares the
+// frame times against a baseline, failing if any phase got slower
+//
+// Build with: gcc -O2 -o perfgate tools/perfgate.c
+//
+// Usage: perfgate [options] replay...
+//   -g GAME      Game executable (default ./Luna2)
+//   -b FILE      Baseline file (default perf_baseline.txt)
+//   -n RUNS      Times every replay is played (default 3)
+//   -t PERCENT   Slowdown allowed before failing (default 10)
+//   -a MS        Slowdowns smaller than this are noise (default 0.02)
+//   -w           Write the baseline instead of checking against it
+//
+// Exits with 1 if p50 or p99 of a phase regressed. Headless runs have no
+// events and no display, so only update, draw and blit are measured (the
+// events and flip columns are 0 in every frame, and are left out).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// At least as many as the phases in src/profile.h
+#define MAX_PHASES      8
+#define MAX_NAME        32
+
+#define TIMINGS_FILE    "perfgate_timings.csv"
+
+struct Phase
+{
+    char name[MAX_NAME];
+    double* times;
+    int count, size;
+};
+
+static struct Phase phases[MAX_PHASES];
+static int phase_count = 0;
+
+static int compare_double(const void* a, const void* b)
+{
+    double d = *(const double*) a - *(const double*) b;
+    return (d > 0) - (d < 0);
+}
+
+static struct Phase* get_phase(const char* name)
+{
+    int i;
+
+    for (i=0; i<phase_count; ++i)
+    {
+        if (strcmp(phases[i].name, name) == 0)
+        {
+            return &phases[i];
+        }
+    }
+
+    if (phase_count == MAX_PHASES)
+    {
+        return NULL;
+    }
+
+    strncpy(phases[phase_count].name, name, MAX_NAME - 1);
+    return &phases[phase_count++];
+}
+
+static void add_time(struct Phase* p, double t)
+{
+    if (p->count == p->size)
+    {
+        p->size = p->size * 2 + 1024;
+        p->times = realloc(p->times, sizeof(double) * p->size);
+    }
+
+    p->times[p->count++] = t;
+}
+
+// Adds the frames of a timings CSV (see profile.h); columns are found by
+// their name, and 'frame' is skipped
+static int read_timings(const char* filename)
+{
+    char line[512];
+    struct Phase* columns[MAX_PHASES + 1];
+    int column_count = 0;
+    char* name;
+    FILE* f = fopen(filename, "r");
+
+    if (f == NULL)
+    {
+        printf("ERROR: No timings in %s\n", filename);
+        return 0;
+    }
+
+    if (fgets(line, sizeof(line), f) == NULL)
+    {
+        printf("ERROR: No timings in %s\n", filename);
+        fclose(f);
+        return 0;
+    }
+
+    name = strtok(line, ",\r\n");
+
+    while (name != NULL && column_count <= MAX_PHASES)
+    {
+        columns[column_count++] = (strcmp(name, "frame") == 0 ? NULL
+            : get_phase(name));
+        name = strtok(NULL, ",\r\n");
+    }
+
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        int i = 0;
+        char* value = strtok(line, ",\r\n");
+
+        while (value != NULL && i < column_count)
+        {
+            if (columns[i] != NULL)
+            {
+                add_time(columns[i], atof(value));
+            }
+
+            value = strtok(NULL, ",\r\n");
+            ++i;
+        }
+    }
+
+    fclose(f);
+
+    return 1;
+}
+
+// Nearest-rank percentile (times have to be sorted)
+static double percentile(struct Phase* p, int pct)
+{
+    int i = (p->count * pct + 99) / 100 - 1;
+
+    if (p->count == 0)
+    {
+        return 0;
+    }
+
+    return p->times[i < 0 ? 0 : i];
+}
+
+// Returns 0 if the baseline doesn't have this replay and phase
+static int find_baseline(const char* filename, const char* replay,
+  const char* phase, double* p50, double* p99)
+{
+    char line[512], r[256], ph[MAX_NAME];
+    FILE* f = fopen(filename, "r");
+    int found = 0;
+
+    if (f == NULL)
+    {
+        return 0;
+    }
+
+    while (!found && fgets(line, sizeof(line), f) != NULL)
+    {
+        if (line[0] != '#' && sscanf(line, "%255s %31s %lf %lf", r, ph, p50,
+            p99) == 4 && strcmp(r, replay) == 0 && strcmp(ph, phase) == 0)
+        {
+            found = 1;
+        }
+    }
+
+    fclose(f);
+
+    return found;
+}
+
+static int check(const char* what, const char* replay, const char* phase,
+  double before, double now, double threshold, double noise)
+{
+    double change = (before > 0 ? (now - before) / before * 100 : 0);
+
+    if (now - before > noise && change > threshold)
+    {
+        printf("REGRESSION: %s %s %s %.4f ms -> %.4f ms (+%.0f%%)\n", replay,
+            phase, what, before, now, change);
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    const char* game = "./Luna2";
+    const char* baseline = "perf_baseline.txt";
+    int runs = 3, write = 0, failed = 0;
+    double threshold = 10, noise = 0.02;
+    FILE* out = NULL;
+    int i, j, run;
+
+    for (i=1; i<argc && argv[i][0] == '-'; ++i)
+    {
+        if (strcmp(argv[i], "-w") == 0)
+        {
+            write = 1;
+        }
+        else if (i + 1 >= argc)
+        {
+            break;
+        }
+        else if (strcmp(argv[i], "-g") == 0)
+        {
+            game = argv[++i];
+        }
+        else if (strcmp(argv[i], "-b") == 0)
+        {
+            baseline = argv[++i];
+        }
+        else if (strcmp(argv[i], "-n") == 0)
+        {
+            runs = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-t") == 0)
+        {
+            threshold = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-a") == 0)
+        {
+            noise = atof(argv[++i]);
+        }
+        else
+        {
+            printf("WARNING: Unknown option %s\n", argv[i]);
+        }
+    }
+
+    if (i >= argc || runs < 1)
+    {
+        puts("Usage: perfgate [-g game] [-b baseline] [-n runs] [-t percent] "
+            "[-a ms] [-w] replay...");
+        return 2;
+    }
+
+    if (write)
+    {
+        out = fopen(baseline, "w");
+
+        if (out == NULL)
+        {
+            printf("ERROR: Could not write %s\n", baseline);
+            return 2;
+        }
+
+        fputs("# replay phase p50_ms p99_ms\n", out);
+    }
+
+    for (; i<argc; ++i)
+    {
+        char command[1024];
+
+        for (j=0; j<phase_count; ++j)
+        {
+            phases[j].count = 0;
+        }
+
+        snprintf(command, sizeof(command),
+            "\"%s\" --headless --draw --replay \"%s\" --timings \"%s\"",
+            game, argv[i], TIMINGS_FILE);
+
+        for (run=0; run<runs; ++run)
+        {
+            if (system(command) != 0 || !read_timings(TIMINGS_FILE))
+            {
+                printf("ERROR: Could not play %s\n", argv[i]);
+                return 2;
+            }
+        }
+
+        for (j=0; j<phase_count; ++j)
+        {
+            struct Phase* p = &phases[j];
+            double p50, p99, base50, base99;
+
+            qsort(p->times, p->count, sizeof(double), compare_double);
+            p50 = percentile(p, 50);
+            p99 = percentile(p, 99);
+
+            if (p->count == 0 || p->times[p->count - 1] == 0)
+            {
+                printf("%s %s: not measured\n", argv[i], p->name);
+                continue;
+            }
+
+            printf("%s %s: p50 %.4f ms, p99 %.4f ms (%d frames)\n", argv[i],
+                p->name, p50, p99, p->count);
+
+            if (write)
+            {
+                fprintf(out, "%s %s %.4f %.4f\n", argv[i], p->name, p50, p99);
+            }
+            else if (find_baseline(baseline, argv[i], p->name, &base50,
+                &base99))
+            {
+                failed |= check("p50", argv[i], p->name, base50, p50,
+                    threshold, noise);
+                failed |= check("p99", argv[i], p->name, base99, p99,
+                    threshold, noise);
+            }
+            else
+            {
+                printf("WARNING: No baseline for %s %s\n", argv[i], p->name);
+            }
+        }
+    }
+
+    remove(TIMINGS_FILE);
+
+    if (out != NULL)
+    {
+        fclose(out);
+        printf("Baseline written to %s\n", baseline);
+    }
+
+    return failed;
+}